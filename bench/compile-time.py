@@ -0,0 +1,156 @@
+#!/usr/bin/env python3
+"""Measures what the reflection costs the build.
+
+Generates translation units with K enums of N values for several scan ranges
+(ENUM_TRAITS_MIN_ENUM_VALUE/ENUM_TRAITS_MAX_ENUM_VALUE) and records, for every
+compiler:
+ - the front-end time (-fsyntax-only, best of --repeat runs),
+ - the peak RSS of the compiler,
+ - the size of the object file and of its read-only data (-O2 -c).
+
+The results are written as JSON (to stdout or --output), one record per
+compiler and configuration.
+"""
+
+import argparse
+import json
+import os
+import platform
+import shutil
+import subprocess
+import sys
+import tempfile
+import time
+
+# short enough for CI; the int16 range takes many minutes with K=10 and is only swept with --full
+DEFAULT_RANGES = [(-128, 127), (-1024, 1023)]
+FULL_RANGES = DEFAULT_RANGES + [(-32768, 32767)]
+
+
+def generate(enums, values, low, high):
+    """Source of a TU with `enums` enums of `values` values spread evenly over [low, high]"""
+    lines = [
+        "#include <enum-traits/enum-traits.hpp>",
+        "",
+        "using namespace etraits;",
+        "",
+    ]
+    step = max(1, (high - low + 1) // max(1, values))
+    for e in range(enums):
+        enumerators = ", ".join(
+            "V{}_{} = {}".format(e, v, low + v * step) for v in range(values) if low + v * step <= high
+        )
+        lines += [
+            "enum class E{} {{ {} }};".format(e, enumerators),
+            "const char* name{0}(E{0} v) {{ return EnumTraits<E{0}>::name(v).c_str(); }}".format(e),
+            "E{0} parse{0}(const char* s) {{ return EnumTraits<E{0}>::fromStr(s); }}".format(e),
+            "",
+        ]
+    return "\n".join(lines)
+
+
+def measure(command):
+    """Runs `command` and returns (wall time in seconds, peak RSS in KiB)"""
+    with tempfile.TemporaryFile() as errors:
+        start = time.perf_counter()
+        process = subprocess.Popen(command, stdout=subprocess.DEVNULL, stderr=errors)
+        _, status, usage = os.wait4(process.pid, 0)
+        elapsed = time.perf_counter() - start
+        if os.waitstatus_to_exitcode(status) != 0:
+            errors.seek(0)
+            raise RuntimeError("{} failed:\n{}".format(" ".join(command), errors.read().decode(errors="replace")))
+    # ru_maxrss is in KiB on Linux but in bytes on macOS
+    rss = usage.ru_maxrss // 1024 if platform.system() == "Darwin" else usage.ru_maxrss
+    return elapsed, rss
+
+
+def rodata_size(path):
+    """Size of the read-only data sections of an object file, or None if `size` is not available"""
+    if shutil.which("size") is None:
+        return None
+    output = subprocess.run(["size", "-A", path], capture_output=True, text=True).stdout
+    total = 0
+    for line in output.splitlines():
+        fields = line.split()
+        if len(fields) >= 2 and fields[0].startswith((".rodata", "__const", "__cstring")):
+            total += int(fields[1])
+    return total
+
+
+def run(compiler, include, std, enums, values, low, high, repeat, workdir):
+    source = os.path.join(workdir, "tu.cpp")
+    with open(source, "w") as f:
+        f.write(generate(enums, values, low, high))
+    flags = [
+        "-std=" + std,
+        "-I" + include,
+        "-DENUM_TRAITS_MIN_ENUM_VALUE={}".format(low),
+        "-DENUM_TRAITS_MAX_ENUM_VALUE={}".format(high),
+    ]
+
+    frontend = None
+    rss = 0
+    for _ in range(repeat):
+        elapsed, peak = measure([compiler] + flags + ["-fsyntax-only", source])
+        frontend = elapsed if frontend is None else min(frontend, elapsed)
+        rss = max(rss, peak)
+
+    obj = os.path.join(workdir, "tu.o")
+    elapsed, peak = measure([compiler] + flags + ["-O2", "-c", source, "-o", obj])
+    return {
+        "compiler": compiler,
+        "enums": enums,
+        "values": values,
+        "min": low,
+        "max": high,
+        "frontend_seconds": round(frontend, 4),
+        "frontend_peak_rss_kib": rss,
+        "compile_seconds": round(elapsed, 4),
+        "compile_peak_rss_kib": peak,
+        "object_bytes": os.path.getsize(obj),
+        "rodata_bytes": rodata_size(obj),
+    }
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    here = os.path.dirname(os.path.abspath(__file__))
+    parser.add_argument("--compiler", action="append", help="compiler to measure (default: g++ and clang++)")
+    parser.add_argument("--include", default=os.path.join(here, "..", "include"), help="enum-traits include dir")
+    parser.add_argument("--std", default="c++14")
+    parser.add_argument("--enums", type=int, nargs="+", default=[1, 10], help="enums per TU (K)")
+    parser.add_argument("--values", type=int, nargs="+", default=[8, 64], help="values per enum (N)")
+    parser.add_argument("--range", nargs=2, type=int, action="append", metavar=("MIN", "MAX"),
+                        help="scan range, may be repeated (default: int8 and [-1024, 1023])")
+    parser.add_argument("--full", action="store_true", help="also sweep the int16 range (slow)")
+    parser.add_argument("--repeat", type=int, default=3, help="front-end runs per configuration")
+    parser.add_argument("--output", help="JSON report path (default: stdout)")
+    args = parser.parse_args()
+
+    compilers = args.compiler or [c for c in ("g++", "clang++") if shutil.which(c)]
+    if not compilers:
+        sys.exit("no compiler found, use --compiler")
+
+    results = []
+    with tempfile.TemporaryDirectory() as workdir:
+        for compiler in compilers:
+            for low, high in args.range or (FULL_RANGES if args.full else DEFAULT_RANGES):
+                for enums in args.enums:
+                    for values in args.values:
+                        result = run(compiler, args.include, args.std, enums, values, low, high, args.repeat,
+                                     workdir)
+                        print("{compiler} K={enums} N={values} [{min}, {max}]: {frontend_seconds}s, "
+                              "{frontend_peak_rss_kib} KiB, {object_bytes} B object".format(**result),
+                              file=sys.stderr)
+                        results.append(result)
+
+    report = json.dumps({"std": args.std, "results": results}, indent=2)
+    if args.output:
+        with open(args.output, "w") as f:
+            f.write(report + "\n")
+    else:
+        print(report)
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,357 @@
+#include "enum-traits/enum-traits.hpp"
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <vector>
+
+#if defined(__linux__)
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+using namespace etraits;
+
+namespace {
+
+template <typename T>
+inline void doNotOptimize(const T& value) {
+#if defined(__clang__) || defined(__GNUC__) || defined(__GNUG__)
+    asm volatile("" : : "r,m"(value) : "memory");
+#else
+    volatile const T sink = value;
+    (void)sink;
+#endif
+}
+
+/// Counts the user-space instructions retired by this thread. Only available on Linux and only when
+/// perf events are permitted (see /proc/sys/kernel/perf_event_paranoid); otherwise reports nothing.
+class InstructionCounter {
+public:
+    InstructionCounter() noexcept {
+#if defined(__linux__)
+        perf_event_attr attr;
+        std::memset(&attr, 0, sizeof(attr));
+        attr.type = PERF_TYPE_HARDWARE;
+        attr.size = sizeof(attr);
+        attr.config = PERF_COUNT_HW_INSTRUCTIONS;
+        attr.disabled = 1;
+        attr.exclude_kernel = 1;
+        attr.exclude_hv = 1;
+        mFd = static_cast<int>(syscall(__NR_perf_event_open, &attr, 0, -1, -1, 0));
+#endif
+    }
+
+    ~InstructionCounter() {
+#if defined(__linux__)
+        if (mFd >= 0) {
+            close(mFd);
+        }
+#endif
+    }
+
+    InstructionCounter(const InstructionCounter&) = delete;
+    InstructionCounter& operator=(const InstructionCounter&) = delete;
+
+    bool available() const noexcept { return mFd >= 0; }
+
+    void start() noexcept {
+#if defined(__linux__)
+        if (available()) {
+            ioctl(mFd, PERF_EVENT_IOC_RESET, 0);
+            ioctl(mFd, PERF_EVENT_IOC_ENABLE, 0);
+        }
+#endif
+    }
+
+    std::uint64_t stop() noexcept {
+        std::uint64_t count = 0;
+#if defined(__linux__)
+        if (available()) {
+            ioctl(mFd, PERF_EVENT_IOC_DISABLE, 0);
+            if (read(mFd, &count, sizeof(count)) != static_cast<ssize_t>(sizeof(count))) {
+                count = 0;
+            }
+        }
+#endif
+        return count;
+    }
+
+private:
+    int mFd = -1;
+};
+
+std::size_t gIterations = 20000000;
+const char* gFilter = nullptr;
+
+/// `opsPerIteration` is the number of operations done by a single call of `func`
+template <typename TFunc>
+void run(const char* name,
+         const std::size_t iterations,
+         TFunc&& func,
+         const std::size_t opsPerIteration = 1) {
+    if (gFilter && !std::strstr(name, gFilter)) {
+        return;
+    }
+    static InstructionCounter counter;
+    counter.start();
+    const auto start = std::chrono::steady_clock::now();
+    for (std::size_t i = 0; i < iterations; ++i) {
+        func(i);
+    }
+    const auto end = std::chrono::steady_clock::now();
+    const std::uint64_t instructions = counter.stop();
+    const auto ns = std::chrono::duration_cast<std::chrono::nanoseconds>(end - start).count();
+    const double ops = static_cast<double>(iterations * opsPerIteration);
+    if (counter.available()) {
+        std::printf("%-48s %8.2f ns/op %8.2f instr/op\n",
+                    name,
+                    static_cast<double>(ns) / ops,
+                    static_cast<double>(instructions) / ops);
+    } else {
+        std::printf("%-48s %8.2f ns/op %8s instr/op\n", name, static_cast<double>(ns) / ops, "n/a");
+    }
+}
+
+// Every enum shape is described once by an X-macro so that the hand-written baselines below are
+// generated from exactly the same enumerators as the reflected ones.
+#define CONTIGUOUS_VALUES(X)                                                                                 \
+    X(Alpha, 0) X(Bravo, 1) X(Charlie, 2) X(Delta, 3) X(Echo, 4) X(Foxtrot, 5) X(Golf, 6) X(Hotel, 7)        \
+    X(India, 8) X(Juliett, 9) X(Kilo, 10) X(Lima, 11) X(Mike, 12) X(November, 13) X(Oscar, 14) X(Papa, 15)   \
+    X(Quebec, 16) X(Romeo, 17) X(Sierra, 18) X(Tango, 19) X(Uniform, 20) X(Victor, 21) X(Whiskey, 22)        \
+    X(Xray, 23) X(Yankee, 24) X(Zulu, 25) X(Zero, 26) X(One, 27) X(Two, 28) X(Three, 29) X(Four, 30)         \
+    X(Five, 31)
+
+#define SPARSE_VALUES(X)                                                                                     \
+    X(Mercury, 0) X(Venus, 10) X(Earth, 20) X(Mars, 30) X(Ceres, 40) X(Jupiter, 50) X(Saturn, 60)            \
+    X(Uranus, 70) X(Neptune, 80) X(Pluto, 90) X(Haumea, 100) X(Makemake, 110) X(Eris, 120)
+
+#define NEGATIVE_VALUES(X)                                                                                   \
+    X(Minus120, -120) X(Minus100, -100) X(Minus80, -80) X(Minus60, -60) X(Minus40, -40) X(Minus20, -20)      \
+    X(Minus10, -10) X(Minus1, -1)
+
+#define MIXED_VALUES(X)                                                                                      \
+    X(Underflow, -100) X(Error, -3) X(Warning, -2) X(None, 0) X(Info, 1) X(Debug, 2) X(Trace, 3)             \
+    X(Verbose, 50) X(Overflow, 127)
+
+#define ENUMERATOR(name, value) name = value,
+#define NAME_CASE(name, value)                                                                               \
+    case Enum::name:                                                                                         \
+        return #name;
+#define NAME_STRING(name, value) #name,
+#define VALUE_OF(name, value) Enum::name,
+
+enum class Contiguous { CONTIGUOUS_VALUES(ENUMERATOR) };
+enum class Sparse { SPARSE_VALUES(ENUMERATOR) };
+enum class Negative { NEGATIVE_VALUES(ENUMERATOR) };
+enum class Mixed { MIXED_VALUES(ENUMERATOR) };
+
+/// Hand-written baselines: a `switch` for name() and a linear `strcmp` search for fromStr()
+template <typename T>
+struct Baseline;
+
+#define DEFINE_BASELINE(TEnum, VALUES)                                                                       \
+    template <>                                                                                              \
+    struct Baseline<TEnum> {                                                                                 \
+        using Enum = TEnum;                                                                                  \
+        static const char* name(const TEnum value) {                                                         \
+            switch (value) { VALUES(NAME_CASE) }                                                             \
+            return "";                                                                                       \
+        }                                                                                                    \
+        static TEnum fromStr(const char* name) {                                                             \
+            static const char* const names[] = { VALUES(NAME_STRING) };                                      \
+            static const TEnum values[] = { VALUES(VALUE_OF) };                                              \
+            for (std::size_t i = 0; i < sizeof(names) / sizeof(names[0]); ++i) {                             \
+                if (std::strcmp(names[i], name) == 0) {                                                      \
+                    return values[i];                                                                        \
+                }                                                                                            \
+            }                                                                                                \
+            return EnumTraits<TEnum>::Invalid;                                                               \
+        }                                                                                                    \
+    };
+
+DEFINE_BASELINE(Contiguous, CONTIGUOUS_VALUES)
+DEFINE_BASELINE(Sparse, SPARSE_VALUES)
+DEFINE_BASELINE(Negative, NEGATIVE_VALUES)
+DEFINE_BASELINE(Mixed, MIXED_VALUES)
+
+template <typename T>
+void benchShape(const char* shape) {
+    char buffer[64];
+    const auto label = [&](const char* what) {
+        std::snprintf(buffer, sizeof(buffer), "%s %s", shape, what);
+        return buffer;
+    };
+    const auto values = EnumTraits<T>::values();
+    const auto names = EnumTraits<T>::names();
+
+    std::vector<T> input(1024);
+    for (std::size_t i = 0; i < input.size(); ++i) {
+        input[i] = values[(i * 7) % values.size()];
+    }
+    run(label("name (switch)"), gIterations, [&](const std::size_t i) {
+        doNotOptimize(Baseline<T>::name(input[i % input.size()]));
+    });
+    run(label("name (EnumTraits)"), gIterations, [&](const std::size_t i) {
+        doNotOptimize(EnumTraits<T>::name(input[i % input.size()]).data());
+    });
+
+    // NUL-terminated copies, so that the strings are not shared with the name pool
+    std::vector<std::vector<char>> storage;
+    const auto copy = [&](const StringView str) {
+        storage.emplace_back(str.data(), str.data() + str.size());
+        storage.back().push_back('\0');
+    };
+    copy(names.front());
+    copy(names.back());
+    copy(names[names.size() / 2]);
+    // Misses: an unknown word, a truncated and an extended name which share the first character
+    copy(StringView("Unknown", 7));
+    copy(StringView(names.front().data(), names.front().size() - 1));
+    storage.emplace_back(names.back().data(), names.back().data() + names.back().size());
+    storage.back().push_back('s');
+    storage.back().push_back('\0');
+    const char* const early = storage[0].data();
+    const char* const late = storage[1].data();
+    const char* const misses[] = { storage[3].data(), storage[4].data(), storage[5].data() };
+
+    std::vector<const char*> hits(1024);
+    for (std::size_t i = 0; i < hits.size(); ++i) {
+        copy(names[(i * 7) % names.size()]);
+    }
+    for (std::size_t i = 0; i < hits.size(); ++i) {
+        hits[i] = storage[6 + i].data();
+    }
+
+    run(label("fromStr hit (strcmp)"), gIterations, [&](const std::size_t i) {
+        doNotOptimize(Baseline<T>::fromStr(hits[i % hits.size()]));
+    });
+    run(label("fromStr hit (EnumTraits)"), gIterations, [&](const std::size_t i) {
+        doNotOptimize(EnumTraits<T>::fromStr(hits[i % hits.size()]));
+    });
+    run(label("fromStr early (strcmp)"), gIterations, [&](const std::size_t) {
+        doNotOptimize(Baseline<T>::fromStr(early));
+    });
+    run(label("fromStr early (EnumTraits)"), gIterations, [&](const std::size_t) {
+        doNotOptimize(EnumTraits<T>::fromStr(early));
+    });
+    run(label("fromStr late (strcmp)"), gIterations, [&](const std::size_t) {
+        doNotOptimize(Baseline<T>::fromStr(late));
+    });
+    run(label("fromStr late (EnumTraits)"), gIterations, [&](const std::size_t) {
+        doNotOptimize(EnumTraits<T>::fromStr(late));
+    });
+    run(label("fromStr miss (strcmp)"), gIterations, [&](const std::size_t i) {
+        doNotOptimize(Baseline<T>::fromStr(misses[i % 3]));
+    });
+    run(label("fromStr miss (EnumTraits)"), gIterations, [&](const std::size_t i) {
+        doNotOptimize(EnumTraits<T>::fromStr(misses[i % 3]));
+    });
+
+    run(
+        label("values()"),
+        gIterations / values.size(),
+        [&](const std::size_t) {
+            long sum = 0;
+            for (const T value : EnumTraits<T>::values()) {
+                sum += static_cast<long>(value);
+            }
+            doNotOptimize(sum);
+        },
+        values.size());
+    run(
+        label("names()"),
+        gIterations / names.size(),
+        [&](const std::size_t) {
+            std::size_t sum = 0;
+            for (const StringView name : EnumTraits<T>::names()) {
+                sum += name.size();
+            }
+            doNotOptimize(sum);
+        },
+        names.size());
+}
+
+enum class Colors { Red, Green, Blue, Cyan, Magenta, Yellow, Black, White, Gray = 20, Orange = 40 };
+
+void benchBatches() {
+    const auto values = EnumTraits<Colors>::values();
+    const char* const strings[] = { "Red", "Orange", "Magenta", "Purple", "Blu", "Whitest" };
+    constexpr std::size_t batchSize = 4096;
+    const std::size_t batches = gIterations / batchSize;
+    std::vector<StringView> views(batchSize);
+    for (std::size_t i = 0; i < views.size(); ++i) {
+        const char* str = strings[(i * 7) % (sizeof(strings) / sizeof(strings[0]))];
+        views[i] = StringView(str, std::strlen(str));
+    }
+    std::vector<Colors> valueInput(batchSize);
+    for (std::size_t i = 0; i < valueInput.size(); ++i) {
+        valueInput[i] = values[(i * 7) % values.size()];
+    }
+    std::vector<Colors> parsed(batchSize);
+    std::vector<std::uint64_t> missMask(batchSize / 64);
+    std::vector<std::uint32_t> offsets(batchSize);
+    std::vector<std::uint32_t> lengths(batchSize);
+
+    run(
+        "batch fromStr (scalar loop)",
+        batches,
+        [&](const std::size_t) {
+            for (std::size_t i = 0; i < batchSize; ++i) {
+                parsed[i] = EnumTraits<Colors>::fromStr(views[i]);
+            }
+            doNotOptimize(parsed.data());
+        },
+        batchSize);
+    run(
+        "batch fromStrBatch",
+        batches,
+        [&](const std::size_t) {
+            doNotOptimize(
+                EnumTraits<Colors>::fromStrBatch(views.data(), batchSize, parsed.data(), missMask.data()));
+        },
+        batchSize);
+    run(
+        "batch name (scalar loop)",
+        batches,
+        [&](const std::size_t) {
+            for (std::size_t i = 0; i < batchSize; ++i) {
+                const StringView name = EnumTraits<Colors>::name(valueInput[i]);
+                offsets[i] = static_cast<std::uint32_t>(name.data() - EnumTraits<Colors>::namePool());
+                lengths[i] = static_cast<std::uint32_t>(name.size());
+            }
+            doNotOptimize(offsets.data());
+        },
+        batchSize);
+    run(
+        "batch namesBatch",
+        batches,
+        [&](const std::size_t) {
+            EnumTraits<Colors>::namesBatch(valueInput.data(), batchSize, offsets.data(), lengths.data());
+            doNotOptimize(offsets.data());
+        },
+        batchSize);
+}
+
+} // namespace
+
+/// Usage: benchmarks [filter] [iterations]
+/// Only the benchmarks whose label contains `filter` are run.
+int main(int argc, char** argv) {
+    if (argc > 1 && argv[1][0] != '\0') {
+        gFilter = argv[1];
+    }
+    if (argc > 2) {
+        gIterations = static_cast<std::size_t>(std::strtoull(argv[2], nullptr, 10));
+    }
+
+    benchShape<Contiguous>("contiguous(32)");
+    benchShape<Sparse>("sparse(13)");
+    benchShape<Negative>("negative(8)");
+    benchShape<Mixed>("mixed(9)");
+    benchBatches();
+    return 0;
+}
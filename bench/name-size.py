@@ -0,0 +1,129 @@
+#!/usr/bin/env python3
+"""Reports how much the name tables of the reflected enums take in a binary.
+
+Generates a program with K enums of N values where S of the names (Unknown,
+None, Default, ...) are shared by all enums, builds it and records:
+ - the footprint of every enum: the symbols of its name tables (the string
+   pool, the offsets and the lengths),
+ - the sizes of the sections holding them (.rodata, .data.rel.ro and the
+   dynamic relocations).
+
+Needs `nm` and `size` from binutils. The results are written as JSON (to
+stdout or --output).
+"""
+
+import argparse
+import json
+import os
+import re
+import shutil
+import subprocess
+import sys
+import tempfile
+
+SHARED_NAMES = ["Unknown", "None", "Default", "Error", "Invalid", "Count", "First", "Last"]
+SECTIONS = [".rodata", ".data.rel.ro", ".rela.dyn"]
+
+
+def generate(enums, values, shared):
+    """Source of a program with `enums` enums of `values` values, `shared` of the names common to all"""
+    lines = [
+        "#include <enum-traits/enum-traits.hpp>",
+        "",
+        "#include <cstdio>",
+        "",
+        "using namespace etraits;",
+        "",
+    ]
+    for e in range(enums):
+        names = SHARED_NAMES[:shared] + ["Value{}_{}".format(e, v) for v in range(values - shared)]
+        lines += [
+            "enum class E{} {{ {} }};".format(e, ", ".join(names)),
+            "__attribute__((noinline)) const char* name{0}(int v) {{".format(e),
+            "    return EnumTraits<E{0}>::name(static_cast<E{0}>(v)).c_str();".format(e),
+            "}",
+            "",
+        ]
+    lines += ["int main(int argc, char**) {"]
+    lines += ['    std::puts(name{}(argc));'.format(e) for e in range(enums)]
+    lines += ["}", ""]
+    return "\n".join(lines)
+
+
+def symbols(path):
+    """(demangled name, size) of every sized symbol of `path`"""
+    output = subprocess.run(["nm", "-S", "-C", path], capture_output=True, text=True, check=True).stdout
+    for line in output.splitlines():
+        fields = line.split(None, 3)
+        if len(fields) == 4:
+            yield fields[3], int(fields[1], 16)
+
+
+def section_sizes(path):
+    output = subprocess.run(["size", "-A", path], capture_output=True, text=True, check=True).stdout
+    sizes = {}
+    for line in output.splitlines():
+        fields = line.split()
+        if len(fields) >= 2 and fields[0] in SECTIONS:
+            sizes[fields[0]] = int(fields[1])
+    return sizes
+
+
+def run(compiler, include, std, enums, values, shared, workdir):
+    source = os.path.join(workdir, "names.cpp")
+    with open(source, "w") as f:
+        f.write(generate(enums, values, shared))
+    binary = os.path.join(workdir, "names")
+    subprocess.run([compiler, "-std=" + std, "-O2", "-fPIE", "-pie", "-I" + include, source, "-o", binary],
+                   check=True)
+
+    per_enum = [0] * enums
+    pattern = re.compile(r"EnumParsedNames<E(\d+)>")
+    for name, size in symbols(binary):
+        match = pattern.search(name)
+        if match:
+            per_enum[int(match.group(1))] += size
+    return {
+        "enums": enums,
+        "values": values,
+        "shared_names": shared,
+        "per_enum_bytes": per_enum,
+        "total_bytes": sum(per_enum),
+        "sections": section_sizes(binary),
+    }
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    here = os.path.dirname(os.path.abspath(__file__))
+    parser.add_argument("--compiler", default="g++", help="compiler to use (gcc or clang)")
+    parser.add_argument("--include", default=os.path.join(here, "..", "include"), help="enum-traits include dir")
+    parser.add_argument("--std", default="c++14")
+    parser.add_argument("--enums", type=int, default=50, help="number of enums (K)")
+    parser.add_argument("--values", type=int, default=12, help="values per enum (N)")
+    parser.add_argument("--shared", type=int, default=4, help="names shared by all enums (S, at most {})"
+                        .format(len(SHARED_NAMES)))
+    parser.add_argument("--output", help="JSON report path (default: stdout)")
+    args = parser.parse_args()
+
+    if not 0 <= args.shared <= min(args.values, len(SHARED_NAMES)):
+        sys.exit("--shared must lie between 0 and min(--values, {})".format(len(SHARED_NAMES)))
+    for tool in ("nm", "size"):
+        if shutil.which(tool) is None:
+            sys.exit("{} not found".format(tool))
+
+    with tempfile.TemporaryDirectory() as workdir:
+        result = run(args.compiler, args.include, args.std, args.enums, args.values, args.shared, workdir)
+    print("{total_bytes} B of name tables, {per_enum} B per enum, sections {sections}".format(
+        per_enum=result["per_enum_bytes"][0], **result), file=sys.stderr)
+
+    report = json.dumps({"compiler": args.compiler, "std": args.std, "result": result}, indent=2)
+    if args.output:
+        with open(args.output, "w") as f:
+            f.write(report + "\n")
+    else:
+        print(report)
+
+
+if __name__ == "__main__":
+    main()
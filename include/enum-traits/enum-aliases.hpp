@@ -0,0 +1,336 @@
+#ifndef ENUM_TRAITS_ENUM_ALIASES_HPP_
+#define ENUM_TRAITS_ENUM_ALIASES_HPP_
+
+#include "enum-traits/enum-traits.hpp"
+
+#include <atomic>
+#include <memory>
+#include <algorithm>
+#include <mutex>
+#include <new>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace etraits {
+
+namespace detail {
+    /// Three-way comparison of the characters of two strings as unsigned chars
+    inline int compare(const StringView lhs, const StringView rhs) noexcept {
+        const std::size_t size = std::min(lhs.size(), rhs.size());
+        for (std::size_t i = 0; i < size; ++i) {
+            const auto l = static_cast<unsigned char>(lhs[i]);
+            const auto r = static_cast<unsigned char>(rhs[i]);
+            if (l != r) {
+                return l < r ? -1 : 1;
+            }
+        }
+        return lhs.size() < rhs.size() ? -1 : (lhs.size() > rhs.size() ? 1 : 0);
+    }
+
+    /// Hazard pointer of a thread: the snapshot it is reading, which must not be freed
+    struct HazardRecord {
+        std::atomic<const void*> pointer{ nullptr };
+        std::atomic<bool> active{ true };
+        HazardRecord* next = nullptr;
+    };
+
+    /// Head of the list of all hazard records, shared by all registries. Records are never freed: the
+    /// record of an exiting thread is released for reuse by another thread.
+    inline std::atomic<HazardRecord*>& getHazardList() noexcept {
+        static std::atomic<HazardRecord*> head{ nullptr };
+        return head;
+    }
+
+    /// Releases the hazard record of a thread when it exits
+    struct HazardOwner {
+        HazardRecord* record = nullptr;
+
+        HazardOwner() noexcept {
+            std::atomic<HazardRecord*>& head = getHazardList();
+            for (HazardRecord* it = head.load(std::memory_order_acquire); it != nullptr; it = it->next) {
+                bool active = false;
+                if (it->active.compare_exchange_strong(active, true, std::memory_order_acquire)) {
+                    record = it;
+                    return;
+                }
+            }
+            record = new (std::nothrow) HazardRecord();
+            if (record != nullptr) {
+                record->next = head.load(std::memory_order_relaxed);
+                while (!head.compare_exchange_weak(record->next, record, std::memory_order_release)) {
+                }
+            }
+        }
+
+        ~HazardOwner() {
+            if (record != nullptr) {
+                record->pointer.store(nullptr, std::memory_order_relaxed);
+                record->active.store(false, std::memory_order_release);
+            }
+        }
+    };
+
+    /// Hazard record of the calling thread, nullptr if it could not be allocated
+    inline HazardRecord* getHazard() noexcept {
+        thread_local HazardOwner owner;
+        return owner.record;
+    }
+
+    /// Whether a thread is reading `pointer`
+    inline bool isHazard(const void* pointer) noexcept {
+        HazardRecord* it = getHazardList().load(std::memory_order_acquire);
+        for (; it != nullptr; it = it->next) {
+            if (it->pointer.load(std::memory_order_seq_cst) == pointer) {
+                return true;
+            }
+        }
+        return false;
+    }
+} // namespace detail
+
+/// Aliases of TEnum registered at runtime (e.g. from a configuration file), on top of its names and the
+/// compile-time aliases of EnumAliasTraits. fromStr() never locks: the runtime aliases are an immutable
+/// sorted snapshot reached through an atomic pointer. add(), remove(), assign() and clear() build a new
+/// snapshot under a mutex and publish it. A reader announces the snapshot it uses in a hazard pointer, and
+/// every publish frees the replaced snapshots which no reader announces.
+template <typename TEnum>
+class EnumAliasRegistry {
+public:
+    /// EnumTraits<TEnum>::fromStr(), then the runtime aliases. Returns EnumTraits<TEnum>::Invalid if
+    /// `name` is neither a name nor an alias. With ENUM_TRAITS_INSTRUMENTATION, the lookup is counted
+    /// once, as a hit if a runtime alias matches.
+    static TEnum fromStr(const StringView name) noexcept {
+        using Traits = EnumTraits<TEnum>;
+        std::uint64_t start = Traits::lookupStart();
+        const std::size_t index =
+            Traits::findIndex(name.data(), name.size(), detail::hashString(name.data(), name.size()));
+        if (index < Traits::count()) {
+            Traits::countLookup(true, start);
+            return Traits::fromIndex(index);
+        }
+        const Reader reader;
+        if (reader.snapshot == nullptr) {
+            Traits::countLookup(false, start);
+            return Traits::Invalid;
+        }
+        const std::size_t alias = reader.snapshot->position(name);
+        const bool hit = alias < reader.snapshot->entries.size();
+        Traits::countLookup(hit, start);
+        return hit ? reader.snapshot->entries[alias].value : Traits::Invalid;
+    }
+
+    static TEnum fromStr(const char* name) noexcept {
+        return fromStr(StringView(name, detail::cstrlen(name)));
+    }
+
+    /// Adds `name` as an alias of `value`, or points an existing runtime alias to `value`. Returns false
+    /// (and changes nothing) if `value` is not valid or `name` is already a name or a compile-time alias.
+    static bool add(const StringView name, const TEnum value) {
+        if (!isAllowed(name, value)) {
+            return false;
+        }
+        Writer& writer = getWriter();
+        std::lock_guard<std::mutex> lock(writer.mutex);
+        std::unique_ptr<Snapshot> next = writer.copy();
+        const auto it = next->lowerBound(name);
+        if (it != next->entries.end() && detail::compare(it->key(), name) == 0) {
+            it->value = value;
+        } else {
+            next->entries.insert(it, Entry{ std::string(name.data(), name.size()), value });
+        }
+        writer.publish(std::move(next));
+        return true;
+    }
+
+    static bool add(const char* name, const TEnum value) {
+        return add(StringView(name, detail::cstrlen(name)), value);
+    }
+
+    /// Replaces all runtime aliases by `aliases`, publishing a single snapshot, e.g. on a configuration
+    /// reload. The pairs which add() would reject are skipped; of repeated names, the last pair wins.
+    /// Returns the number of skipped pairs.
+    static std::size_t assign(std::vector<std::pair<std::string, TEnum>> aliases) {
+        std::unique_ptr<Snapshot> next(new Snapshot());
+        next->entries.reserve(aliases.size());
+        for (auto& alias : aliases) {
+            if (isAllowed(StringView(alias.first.data(), alias.first.size()), alias.second)) {
+                next->entries.push_back(Entry{ std::move(alias.first), alias.second });
+            }
+        }
+        const std::size_t skipped = aliases.size() - next->entries.size();
+        next->sort();
+
+        Writer& writer = getWriter();
+        std::lock_guard<std::mutex> lock(writer.mutex);
+        writer.publish(std::move(next));
+        return skipped;
+    }
+
+    /// Removes the runtime alias `name`. Returns false if there is no such alias.
+    static bool remove(const StringView name) {
+        Writer& writer = getWriter();
+        std::lock_guard<std::mutex> lock(writer.mutex);
+        std::unique_ptr<Snapshot> next = writer.copy();
+        const auto it = next->lowerBound(name);
+        if (it == next->entries.end() || detail::compare(it->key(), name) != 0) {
+            return false;
+        }
+        next->entries.erase(it);
+        writer.publish(std::move(next));
+        return true;
+    }
+
+    static bool remove(const char* name) { return remove(StringView(name, detail::cstrlen(name))); }
+
+    /// Removes all runtime aliases
+    static void clear() {
+        Writer& writer = getWriter();
+        std::lock_guard<std::mutex> lock(writer.mutex);
+        writer.publish(std::unique_ptr<Snapshot>(new Snapshot()));
+    }
+
+    /// Number of runtime aliases
+    static std::size_t size() noexcept {
+        const Reader reader;
+        return reader.snapshot != nullptr ? reader.snapshot->entries.size() : 0;
+    }
+
+private:
+    struct Entry {
+        std::string name;
+        TEnum value;
+
+        StringView key() const noexcept { return StringView(name.data(), name.size()); }
+    };
+
+    struct Snapshot {
+        std::vector<Entry> entries; ///< sorted by name
+
+        typename std::vector<Entry>::iterator lowerBound(const StringView name) {
+            const auto less = [](const Entry& entry, const StringView key) {
+                return detail::compare(entry.key(), key) < 0;
+            };
+            return std::lower_bound(entries.begin(), entries.end(), name, less);
+        }
+
+        /// Sorts the entries, keeping the last one of repeated names
+        void sort() {
+            std::stable_sort(entries.begin(), entries.end(), [](const Entry& lhs, const Entry& rhs) {
+                return detail::compare(lhs.key(), rhs.key()) < 0;
+            });
+            std::size_t size = 0;
+            for (std::size_t i = 0; i < entries.size(); ++i) {
+                if (size != 0 && detail::compare(entries[size - 1].key(), entries[i].key()) == 0) {
+                    entries[size - 1].value = entries[i].value;
+                } else {
+                    if (size != i) {
+                        entries[size] = std::move(entries[i]);
+                    }
+                    ++size;
+                }
+            }
+            entries.erase(entries.begin() + static_cast<std::ptrdiff_t>(size), entries.end());
+        }
+
+        /// Position of the entry named `name`, or entries.size() if there is none
+        std::size_t position(const StringView name) const noexcept {
+            std::size_t low = 0;
+            std::size_t high = entries.size();
+            while (low < high) {
+                const std::size_t middle = low + (high - low) / 2;
+                const int order = detail::compare(entries[middle].key(), name);
+                if (order == 0) {
+                    return middle;
+                }
+                if (order < 0) {
+                    low = middle + 1;
+                } else {
+                    high = middle;
+                }
+            }
+            return entries.size();
+        }
+    };
+
+    /// State of the writers. The published snapshot is owned by `latest`, the replaced ones which may still
+    /// be read by `retired`.
+    struct Writer {
+        std::mutex mutex;
+        std::unique_ptr<Snapshot> latest;
+        std::vector<std::unique_ptr<Snapshot>> retired;
+
+        ~Writer() { current.store(nullptr, std::memory_order_release); }
+
+        std::unique_ptr<Snapshot> copy() const {
+            return std::unique_ptr<Snapshot>(latest != nullptr ? new Snapshot(*latest) : new Snapshot());
+        }
+
+        void publish(std::unique_ptr<Snapshot> next) {
+            // seq_cst pairs with Reader: either the reader sees `next`, or its hazard is seen below
+            current.store(next.get(), std::memory_order_seq_cst);
+            if (latest != nullptr) {
+                retired.push_back(std::move(latest));
+            }
+            latest = std::move(next);
+            const auto unused = [](const std::unique_ptr<Snapshot>& snapshot) {
+                return !detail::isHazard(snapshot.get());
+            };
+            retired.erase(std::remove_if(retired.begin(), retired.end(), unused), retired.end());
+        }
+    };
+
+    /// The published snapshot, protected by the hazard pointer of the calling thread until destruction.
+    /// Falls back to the writer mutex if the hazard record could not be allocated.
+    struct Reader {
+        detail::HazardRecord* hazard = detail::getHazard();
+        std::unique_lock<std::mutex> lock;
+        const Snapshot* snapshot = nullptr;
+
+        Reader() noexcept {
+            if (hazard == nullptr) {
+                lock = std::unique_lock<std::mutex>(getWriter().mutex);
+                snapshot = current.load(std::memory_order_acquire);
+                return;
+            }
+            const Snapshot* published = current.load(std::memory_order_relaxed);
+            do {
+                snapshot = published;
+                hazard->pointer.store(snapshot, std::memory_order_seq_cst);
+                published = current.load(std::memory_order_seq_cst);
+            } while (published != snapshot);
+        }
+
+        ~Reader() {
+            if (hazard != nullptr) {
+                hazard->pointer.store(nullptr, std::memory_order_release);
+            }
+        }
+
+        Reader(const Reader&) = delete;
+        Reader& operator=(const Reader&) = delete;
+    };
+
+    /// Whether `name` may become a runtime alias of `value`
+    static bool isAllowed(const StringView name, const TEnum value) noexcept {
+        using Traits = EnumTraits<TEnum>;
+        return Traits::isValid(value) &&
+               Traits::findIndex(name.data(), name.size(), detail::hashString(name.data(), name.size())) >=
+                   Traits::count();
+    }
+
+    static Writer& getWriter() {
+        static Writer writer;
+        return writer;
+    }
+
+    // constant-initialized, so lookups work during static initialization and never run a guard
+    static std::atomic<const Snapshot*> current;
+};
+
+template <typename TEnum>
+std::atomic<const typename EnumAliasRegistry<TEnum>::Snapshot*> EnumAliasRegistry<TEnum>::current{ nullptr };
+
+} // namespace etraits
+
+#endif // ENUM_TRAITS_ENUM_ALIASES_HPP_
@@ -0,0 +1,123 @@
+#ifndef ENUM_TRAITS_ENUM_CODEC_HPP_
+#define ENUM_TRAITS_ENUM_CODEC_HPP_
+
+#include "enum-traits/enum-traits.hpp"
+
+#include <cassert>
+
+namespace etraits {
+
+namespace detail {
+    /// Number of bits needed to store every value up to `max`
+    constexpr std::size_t bitWidth(const std::size_t max) noexcept {
+        std::size_t bits = 0;
+        while (bits < 64 && (max >> bits) != 0) {
+            ++bits;
+        }
+        return bits;
+    }
+
+    /// Hash of all the names and values of TEnum, in the order of EnumValues
+    template <typename TEnum>
+    constexpr std::uint64_t getFingerprint() noexcept {
+        std::uint64_t hash = HashOffset;
+        for (std::size_t i = 0; i < EnumCount<TEnum>::value; ++i) {
+            const StringView name = EnumNames<TEnum>::get(i);
+            for (std::size_t c = 0; c < name.size(); ++c) {
+                hash = hashStep(hash, name[c]);
+            }
+            // the value always takes 8 bytes, so it also separates the names
+            const auto value = static_cast<std::uint64_t>(EnumValues<TEnum>::value[i]);
+            for (std::size_t byte = 0; byte < 8; ++byte) {
+                hash = hashStep(hash, static_cast<char>(value >> (byte * 8)));
+            }
+        }
+        return hashFinish(hash);
+    }
+} // namespace detail
+
+/// Compact binary encoding of TEnum: a value is stored as its position in EnumTraits<TEnum>::values(),
+/// either as a single CodeType or bit-packed with `bits` bits per value. Readers should compare the
+/// fingerprint of the writer with their own, since the codes change whenever values are added or removed.
+template <typename TEnum>
+struct EnumCodec {
+    static constexpr std::size_t count = detail::EnumCount<TEnum>::value;
+    static_assert(count != 0, "TEnum has no valid values to encode");
+
+    /// Smallest unsigned type holding every code, uint8_t for up to 256 values
+    using CodeType = detail::SmallestUnsigned<count - 1>;
+
+    /// Bits per value in pack(), ceil(log2(count)) but at least 1
+    static constexpr std::size_t bits = count > 1 ? detail::bitWidth(count - 1) : 1;
+
+    /// Hash of all names and values of TEnum; equal fingerprints mean equal codes
+    static constexpr std::uint64_t fingerprint = detail::getFingerprint<TEnum>();
+
+    /// `value` must be a valid value of TEnum
+    static constexpr CodeType encode(const TEnum value) noexcept {
+        const std::size_t index = EnumTraits<TEnum>::index(value);
+        assert(index < count);
+        return static_cast<CodeType>(index);
+    }
+
+    /// Returns EnumTraits<TEnum>::Invalid if `code` is not lower than count
+    static constexpr TEnum decode(const std::size_t code) noexcept {
+        return EnumTraits<TEnum>::fromIndex(code);
+    }
+
+    /// Number of bytes pack() writes for `size` values
+    static constexpr std::size_t packedSize(const std::size_t size) noexcept {
+        return (size * bits + 7) / 8;
+    }
+
+    /// Writes the codes of `size` values to `out` (packedSize(size) bytes), `bits` bits each starting
+    /// with the lowest bits of the first byte. All values must be valid.
+    static void pack(const TEnum* values, const std::size_t size, std::uint8_t* out) noexcept {
+        std::uint64_t buffer = 0;
+        std::size_t buffered = 0;
+        for (std::size_t i = 0; i < size; ++i) {
+            buffer |= static_cast<std::uint64_t>(encode(values[i])) << buffered;
+            buffered += bits;
+            for (; buffered >= 8; buffered -= 8) {
+                *out++ = static_cast<std::uint8_t>(buffer);
+                buffer >>= 8;
+            }
+        }
+        if (buffered != 0) {
+            *out = static_cast<std::uint8_t>(buffer);
+        }
+    }
+
+    /// Reads `size` values written by pack(). Codes without a value (from a writer with a different
+    /// fingerprint) are decoded as Invalid; returns the number of such codes.
+    static std::size_t unpack(const std::uint8_t* in, const std::size_t size, TEnum* values) noexcept {
+        constexpr std::uint64_t mask = (static_cast<std::uint64_t>(1) << bits) - 1;
+        std::uint64_t buffer = 0;
+        std::size_t buffered = 0;
+        std::size_t invalid = 0;
+        for (std::size_t i = 0; i < size; ++i) {
+            for (; buffered < bits; buffered += 8) {
+                buffer |= static_cast<std::uint64_t>(*in++) << buffered;
+            }
+            const auto code = static_cast<std::size_t>(buffer & mask);
+            buffer >>= bits;
+            buffered -= bits;
+            values[i] = decode(code);
+            invalid += code < count ? 0 : 1;
+        }
+        return invalid;
+    }
+};
+
+template <typename TEnum>
+constexpr std::size_t EnumCodec<TEnum>::count;
+
+template <typename TEnum>
+constexpr std::size_t EnumCodec<TEnum>::bits;
+
+template <typename TEnum>
+constexpr std::uint64_t EnumCodec<TEnum>::fingerprint;
+
+} // namespace etraits
+
+#endif // ENUM_TRAITS_ENUM_CODEC_HPP_
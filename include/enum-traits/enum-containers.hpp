@@ -0,0 +1,305 @@
+#ifndef ENUM_TRAITS_ENUM_CONTAINERS_HPP_
+#define ENUM_TRAITS_ENUM_CONTAINERS_HPP_
+
+#include "enum-traits/enum-traits.hpp"
+
+#include <cassert>
+#include <initializer_list>
+#include <iterator>
+#include <utility>
+
+namespace etraits {
+
+/// Fixed-size array with exactly one element per valid value of TEnum, indexed by the enum itself.
+/// Elements are stored (and iterated) in the order of EnumTraits<TEnum>::values().
+template <typename TEnum, typename TValue>
+class EnumArray {
+public:
+    using key_type = TEnum;
+    using value_type = TValue;
+    using size_type = std::size_t;
+    using reference = TValue&;
+    using const_reference = const TValue&;
+    using iterator = TValue*;
+    using const_iterator = const TValue*;
+
+    static constexpr std::size_t size() noexcept { return EnumTraits<TEnum>::count(); }
+
+    /// All keys, in the order of the elements
+    static constexpr auto keys() noexcept { return EnumTraits<TEnum>::values(); }
+
+    constexpr EnumArray() noexcept = default;
+
+    explicit EnumArray(const TValue& value) { fill(value); }
+
+    /// `key` must be a valid value of TEnum
+    constexpr TValue& operator[](const TEnum key) noexcept {
+        const std::size_t index = EnumTraits<TEnum>::index(key);
+        assert(index < size());
+        return mData[index];
+    }
+
+    /// `key` must be a valid value of TEnum
+    constexpr const TValue& operator[](const TEnum key) const noexcept {
+        const std::size_t index = EnumTraits<TEnum>::index(key);
+        assert(index < size());
+        return mData[index];
+    }
+
+    void fill(const TValue& value) {
+        for (TValue& element : mData) {
+            element = value;
+        }
+    }
+
+    constexpr TValue* data() noexcept { return mData.data(); }
+    constexpr const TValue* data() const noexcept { return mData.data(); }
+
+    constexpr iterator begin() noexcept { return mData.data(); }
+    constexpr iterator end() noexcept { return mData.data() + size(); }
+    constexpr const_iterator begin() const noexcept { return mData.data(); }
+    constexpr const_iterator end() const noexcept { return mData.data() + size(); }
+
+private:
+    std::array<TValue, EnumTraits<TEnum>::count()> mData{};
+};
+
+/// Set of values of TEnum stored as a bitset over the dense index (one bit per valid value).
+/// Iteration yields the contained values in ascending order.
+template <typename TEnum>
+class EnumSet {
+    static constexpr std::size_t WordBits = 64;
+    static constexpr std::size_t WordCount = (EnumTraits<TEnum>::count() + WordBits - 1) / WordBits;
+
+public:
+    class Iterator {
+    public:
+        using iterator_category = std::forward_iterator_tag;
+        using value_type = TEnum;
+        using difference_type = std::ptrdiff_t;
+        using pointer = const TEnum*;
+        using reference = TEnum;
+
+        Iterator(const EnumSet* set, const std::size_t index) noexcept
+            : mSet(set)
+            , mIndex(set->next(index)) {}
+
+        TEnum operator*() const noexcept { return EnumTraits<TEnum>::fromIndex(mIndex); }
+
+        Iterator& operator++() noexcept {
+            mIndex = mSet->next(mIndex + 1);
+            return *this;
+        }
+
+        Iterator operator++(int) noexcept {
+            Iterator copy = *this;
+            ++*this;
+            return copy;
+        }
+
+        bool operator==(const Iterator& other) const noexcept { return mIndex == other.mIndex; }
+        bool operator!=(const Iterator& other) const noexcept { return mIndex != other.mIndex; }
+
+    private:
+        const EnumSet* mSet;
+        std::size_t mIndex;
+    };
+
+    using value_type = TEnum;
+    using size_type = std::size_t;
+    using iterator = Iterator;
+    using const_iterator = Iterator;
+
+    constexpr EnumSet() noexcept = default;
+
+    EnumSet(std::initializer_list<TEnum> values) noexcept {
+        for (const TEnum value : values) {
+            insert(value);
+        }
+    }
+
+    /// Set of all valid values of TEnum
+    static EnumSet all() noexcept {
+        EnumSet set;
+        for (std::size_t i = 0; i < WordCount; ++i) {
+            set.mWords[i] = ~std::uint64_t(0);
+        }
+        set.trim();
+        return set;
+    }
+
+    static constexpr std::size_t capacity() noexcept { return EnumTraits<TEnum>::count(); }
+
+    /// Invalid values are ignored
+    void insert(const TEnum value) noexcept {
+        const std::size_t index = EnumTraits<TEnum>::index(value);
+        if (index < capacity()) {
+            mWords[index / WordBits] |= std::uint64_t(1) << (index % WordBits);
+        }
+    }
+
+    void erase(const TEnum value) noexcept {
+        const std::size_t index = EnumTraits<TEnum>::index(value);
+        if (index < capacity()) {
+            mWords[index / WordBits] &= ~(std::uint64_t(1) << (index % WordBits));
+        }
+    }
+
+    bool contains(const TEnum value) const noexcept {
+        const std::size_t index = EnumTraits<TEnum>::index(value);
+        return index < capacity() && ((mWords[index / WordBits] >> (index % WordBits)) & 1) != 0;
+    }
+
+    std::size_t size() const noexcept {
+        std::size_t size = 0;
+        for (const std::uint64_t word : mWords) {
+            size += detail::popCount(word);
+        }
+        return size;
+    }
+
+    bool empty() const noexcept {
+        std::uint64_t any = 0;
+        for (const std::uint64_t word : mWords) {
+            any |= word;
+        }
+        return any == 0;
+    }
+
+    void clear() noexcept { mWords = {}; }
+
+    Iterator begin() const noexcept { return Iterator(this, 0); }
+    Iterator end() const noexcept { return Iterator(this, capacity()); }
+
+    EnumSet& operator|=(const EnumSet& other) noexcept {
+        for (std::size_t i = 0; i < WordCount; ++i) {
+            mWords[i] |= other.mWords[i];
+        }
+        return *this;
+    }
+
+    EnumSet& operator&=(const EnumSet& other) noexcept {
+        for (std::size_t i = 0; i < WordCount; ++i) {
+            mWords[i] &= other.mWords[i];
+        }
+        return *this;
+    }
+
+    EnumSet& operator^=(const EnumSet& other) noexcept {
+        for (std::size_t i = 0; i < WordCount; ++i) {
+            mWords[i] ^= other.mWords[i];
+        }
+        return *this;
+    }
+
+    /// Removes all values contained in `other`
+    EnumSet& operator-=(const EnumSet& other) noexcept {
+        for (std::size_t i = 0; i < WordCount; ++i) {
+            mWords[i] &= ~other.mWords[i];
+        }
+        return *this;
+    }
+
+    friend EnumSet operator|(EnumSet lhs, const EnumSet& rhs) noexcept { return lhs |= rhs; }
+    friend EnumSet operator&(EnumSet lhs, const EnumSet& rhs) noexcept { return lhs &= rhs; }
+    friend EnumSet operator^(EnumSet lhs, const EnumSet& rhs) noexcept { return lhs ^= rhs; }
+    friend EnumSet operator-(EnumSet lhs, const EnumSet& rhs) noexcept { return lhs -= rhs; }
+
+    friend bool operator==(const EnumSet& lhs, const EnumSet& rhs) noexcept {
+        return lhs.mWords == rhs.mWords;
+    }
+    friend bool operator!=(const EnumSet& lhs, const EnumSet& rhs) noexcept { return !(lhs == rhs); }
+
+private:
+    /// Index of the first contained value at or after `index`, or capacity() if there is none
+    std::size_t next(const std::size_t index) const noexcept {
+        if (index >= capacity()) {
+            return capacity();
+        }
+        std::size_t word = index / WordBits;
+        std::uint64_t bits = mWords[word] & (~std::uint64_t(0) << (index % WordBits));
+        while (bits == 0) {
+            if (++word == WordCount) {
+                return capacity();
+            }
+            bits = mWords[word];
+        }
+        return word * WordBits + detail::countTrailingZeros(bits);
+    }
+
+    /// Clears the unused bits of the last word
+    void trim() noexcept {
+        if (WordCount > 0 && capacity() % WordBits != 0) {
+            mWords[WordCount - 1] &= (std::uint64_t(1) << (capacity() % WordBits)) - 1;
+        }
+    }
+
+    std::array<std::uint64_t, WordCount> mWords{};
+};
+
+/// Map from the values of TEnum to TValue with the storage of an EnumArray and the keys kept in an
+/// EnumSet. Iterating over keys() yields the contained keys in ascending order.
+template <typename TEnum, typename TValue>
+class EnumMap {
+public:
+    using key_type = TEnum;
+    using mapped_type = TValue;
+    using size_type = std::size_t;
+
+    /// Returns the value of `key`, inserting a default-constructed one if it is not present yet.
+    /// `key` must be a valid value of TEnum, use insert() for untrusted keys.
+    TValue& operator[](const TEnum key) {
+        assert(EnumTraits<TEnum>::isValid(key));
+        mKeys.insert(key);
+        return mValues[key];
+    }
+
+    /// Sets the value of `key`. Returns false (and does nothing) if `key` is not a valid value of TEnum.
+    bool insert(const TEnum key, TValue value) {
+        if (!EnumTraits<TEnum>::isValid(key)) {
+            return false;
+        }
+        mKeys.insert(key);
+        mValues[key] = std::move(value);
+        return true;
+    }
+
+    /// Returns nullptr if `key` is not present
+    TValue* find(const TEnum key) noexcept { return mKeys.contains(key) ? &mValues[key] : nullptr; }
+
+    /// Returns nullptr if `key` is not present
+    const TValue* find(const TEnum key) const noexcept {
+        return mKeys.contains(key) ? &mValues[key] : nullptr;
+    }
+
+    bool contains(const TEnum key) const noexcept { return mKeys.contains(key); }
+
+    /// Returns false if `key` was not present
+    bool erase(const TEnum key) {
+        if (!mKeys.contains(key)) {
+            return false;
+        }
+        mKeys.erase(key);
+        mValues[key] = TValue();
+        return true;
+    }
+
+    void clear() {
+        mKeys.clear();
+        mValues.fill(TValue());
+    }
+
+    std::size_t size() const noexcept { return mKeys.size(); }
+
+    bool empty() const noexcept { return mKeys.empty(); }
+
+    const EnumSet<TEnum>& keys() const noexcept { return mKeys; }
+
+private:
+    EnumArray<TEnum, TValue> mValues;
+    EnumSet<TEnum> mKeys;
+};
+
+} // namespace etraits
+
+#endif // ENUM_TRAITS_ENUM_CONTAINERS_HPP_
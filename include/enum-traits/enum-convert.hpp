@@ -0,0 +1,94 @@
+#ifndef ENUM_TRAITS_ENUM_CONVERT_HPP_
+#define ENUM_TRAITS_ENUM_CONVERT_HPP_
+
+#include "enum-traits/enum-traits.hpp"
+
+namespace etraits {
+
+namespace detail {
+    /// Translation of the values of TFrom to the values of TTo with the same names, built at compile time
+    /// by looking up every name of TFrom in the perfect hash of TTo
+    template <typename TTo, typename TFrom>
+    struct EnumConversion {
+        using Lookup = PerfectHash<EnumNames<TTo>>;
+
+        static constexpr std::size_t range = EnumRange<TFrom>::value;
+        static constexpr std::size_t size = EnumCount<TFrom>::value;
+
+        /// Position of the name of the i-th value of TFrom among the names of TTo, or Lookup::size
+        static constexpr std::size_t find(const std::size_t i) noexcept {
+            const StringView name = EnumNames<TFrom>::get(i);
+            return Lookup::find(name.data(), name.size(), hashString(name.data(), name.size()));
+        }
+
+        static constexpr std::size_t getUnmatchedCount() noexcept {
+            std::size_t count = 0;
+            for (std::size_t i = 0; i < size; ++i) {
+                count += find(i) < Lookup::size ? 0 : 1;
+            }
+            return count;
+        }
+
+        static constexpr std::size_t unmatchedCount = getUnmatchedCount();
+
+        /// The converted value of every slot of TFrom (see getSlot)
+        static constexpr Table<TTo, range> getTable() noexcept {
+            Table<TTo, range> table{};
+            for (std::size_t slot = 0, k = 0; slot < range; ++slot) {
+                table[slot] = EnumTraits<TTo>::Invalid;
+                if (EnumValidFlags<TFrom>::get(slot)) {
+                    const std::size_t index = find(k++);
+                    if (index < Lookup::size) {
+                        table[slot] = EnumValues<TTo>::value[index];
+                    }
+                }
+            }
+            return table;
+        }
+
+        static constexpr Table<TTo, range> table = getTable();
+
+        template <std::size_t... I>
+        static constexpr std::array<TFrom, unmatchedCount> getUnmatched(std::index_sequence<I...>) noexcept {
+            Table<TFrom, unmatchedCount> unmatched{};
+            for (std::size_t i = 0, k = 0; i < size; ++i) {
+                if (find(i) == Lookup::size) {
+                    unmatched[k++] = EnumValues<TFrom>::value[i];
+                }
+            }
+            return { { unmatched[I]... } };
+        }
+    };
+
+    template <typename TTo, typename TFrom>
+    constexpr Table<TTo, EnumConversion<TTo, TFrom>::range> EnumConversion<TTo, TFrom>::table;
+} // namespace detail
+
+/// Values of TFrom without a value of the same name in TTo, which convert<TTo>() turns into Invalid
+template <typename TTo, typename TFrom>
+constexpr std::array<TFrom, detail::EnumConversion<TTo, TFrom>::unmatchedCount> unmatchedValues() noexcept {
+    using Conversion = detail::EnumConversion<TTo, TFrom>;
+    return Conversion::getUnmatched(std::make_index_sequence<Conversion::unmatchedCount>{});
+}
+
+/// Converts `value` to the value of TTo with the same name, or to EnumTraits<TTo>::Invalid if there is
+/// no such value (or `value` is not valid). The names are matched at compile time, so this is a single
+/// table load.
+template <typename TTo, typename TFrom>
+constexpr TTo convert(const TFrom value) noexcept {
+    using Conversion = detail::EnumConversion<TTo, TFrom>;
+    const std::size_t slot = detail::getSlot(value);
+    return slot < Conversion::range ? Conversion::table[slot] : EnumTraits<TTo>::Invalid;
+}
+
+/// Same as convert(), but only compiles if every value of TFrom has a value of the same name in TTo
+template <typename TTo, typename TFrom>
+constexpr TTo convertStrict(const TFrom value) noexcept {
+    static_assert(detail::EnumConversion<TTo, TFrom>::unmatchedCount == 0,
+                  "Some values of TFrom have no value of the same name in TTo, see unmatchedValues()");
+    return convert<TTo>(value);
+}
+
+} // namespace etraits
+
+#endif // ENUM_TRAITS_ENUM_CONVERT_HPP_
@@ -0,0 +1,170 @@
+#ifndef ENUM_TRAITS_ENUM_EXTERN_HPP_
+#define ENUM_TRAITS_ENUM_EXTERN_HPP_
+
+#include "enum-traits/enum-traits.hpp"
+
+namespace etraits {
+
+namespace detail {
+    /// Reflection tables of an enum declared with ENUM_TRAITS_DECLARE. The lookups which depend on the
+    /// shape of the enum (dense index, perfect hash) are reached through function pointers.
+    template <typename TEnum>
+    struct EnumExternData {
+        using type = typename std::underlying_type<TEnum>::type;
+
+        type min;
+        type max;
+        std::size_t count;
+        const TEnum* values;
+        const StringView* names; ///< `count` names followed by the empty name of invalid values
+        std::size_t (*index)(TEnum);
+        std::size_t (*find)(const char*, std::size_t);
+    };
+
+    /// Builds the EnumExternData of TEnum from the full reflection; only ENUM_TRAITS_DEFINE instantiates it
+    template <typename TEnum>
+    struct EnumExternBuilder {
+        static constexpr std::size_t count = EnumCount<TEnum>::value;
+        static constexpr std::size_t range = EnumRange<TEnum>::value;
+
+        template <std::size_t... I>
+        static constexpr Table<TEnum, count> getValues(std::index_sequence<I...>) noexcept {
+            return { { EnumValues<TEnum>::value[I]... } };
+        }
+
+        template <std::size_t... I>
+        static constexpr Table<StringView, count + 1> getNames(std::index_sequence<I...>) noexcept {
+            return { { EnumNames<TEnum>::get(I)... } };
+        }
+
+        static constexpr Table<TEnum, count> values = getValues(std::make_index_sequence<count>{});
+        static constexpr Table<StringView, count + 1> names = getNames(std::make_index_sequence<count + 1>{});
+
+        static std::size_t index(const TEnum value) noexcept {
+            const std::size_t slot = getSlot(value);
+            return slot < range ? EnumDenseIndex<TEnum>::value[slot] : count;
+        }
+
+        static std::size_t find(const char* name, const std::size_t size) noexcept {
+            const std::size_t key = PerfectHash<EnumKeys<TEnum>>::find(name, size, hashString(name, size));
+            return getKeyIndex<TEnum>(key, HasAliases<TEnum>{});
+        }
+
+        static constexpr EnumExternData<TEnum> get() noexcept {
+            return {
+                EnumMin<TEnum>::value, EnumMax<TEnum>::value, count, values.data, names.data, &index, &find
+            };
+        }
+    };
+
+    template <typename TEnum>
+    constexpr Table<TEnum, EnumExternBuilder<TEnum>::count> EnumExternBuilder<TEnum>::values;
+
+    template <typename TEnum>
+    constexpr Table<StringView, EnumExternBuilder<TEnum>::count + 1> EnumExternBuilder<TEnum>::names;
+} // namespace detail
+
+/// EnumTraits of an enum declared with ENUM_TRAITS_DECLARE: the same API backed by tables built once
+/// by ENUM_TRAITS_DEFINE, so nothing is scanned or parsed where it is used. Nothing is constexpr and
+/// values()/names() return ArrayViews, so EnumArray, EnumSet and EnumMap are not available.
+template <typename T>
+struct ExternEnumTraits {
+    using UnderlyingType = typename std::underlying_type<T>::type;
+    using ValueType = T;
+
+    static constexpr ValueType Invalid = static_cast<T>(std::numeric_limits<UnderlyingType>::max());
+
+    static UnderlyingType min() noexcept { return tables.min; }
+
+    static UnderlyingType max() noexcept { return tables.max; }
+
+    /// Number of valid values
+    static std::size_t count() noexcept { return tables.count; }
+
+    static ArrayView<T> values() noexcept { return ArrayView<T>(tables.values, tables.count); }
+
+    static ArrayView<StringView> names() noexcept {
+        return ArrayView<StringView>(tables.names, tables.count);
+    }
+
+    static StringView name(const T value) noexcept { return tables.names[tables.index(value)]; }
+
+    /// See EnumTraits::writeName()
+    static std::size_t writeName(const T value, char* out, const std::size_t capacity) noexcept {
+        const StringView name = ExternEnumTraits::name(value);
+        if (capacity != 0) {
+            std::copy_n(name.data(), std::min(name.size(), capacity), out);
+        }
+        return name.size();
+    }
+
+    static bool isValid(const T value) noexcept { return tables.index(value) < tables.count; }
+
+    static bool isValid(const UnderlyingType value) noexcept { return isValid(static_cast<T>(value)); }
+
+    /// Position of `value` in values(), or count() if `value` is not valid
+    static std::size_t index(const T value) noexcept { return tables.index(value); }
+
+    /// The value at position `index` in values(), or Invalid if `index` is not lower than count()
+    static T fromIndex(const std::size_t index) noexcept {
+        return index < tables.count ? tables.values[index] : Invalid;
+    }
+
+    static T fromStr(const char* name) noexcept {
+        std::size_t size = 0;
+        while (name[size] != 0) {
+            ++size;
+        }
+        return fromStr(name, size);
+    }
+
+    static T fromStr(const char* name, const std::size_t size) noexcept {
+        const std::size_t index = tables.find(name, size);
+        return index < tables.count ? tables.values[index] : Invalid;
+    }
+
+    static T fromStr(const StringView name) noexcept { return fromStr(name.data(), name.size()); }
+
+private:
+    template <typename>
+    friend class EnumAliasRegistry;
+
+    // lookup hooks of EnumAliasRegistry, see EnumTraits; the lookups of extern enums are not counted
+
+    static std::size_t findIndex(const char* name, const std::size_t size, std::uint64_t) noexcept {
+        return tables.find(name, size);
+    }
+
+    static std::uint64_t lookupStart() noexcept { return 0; }
+
+    static void countLookup(bool, std::uint64_t) noexcept {}
+
+    static const detail::EnumExternData<T> tables;
+};
+
+template <typename T>
+constexpr typename ExternEnumTraits<T>::ValueType ExternEnumTraits<T>::Invalid;
+
+} // namespace etraits
+
+/// Makes EnumTraits<TEnum> use reflection tables built by ENUM_TRAITS_DEFINE(TEnum) in a single
+/// translation unit. Must be used in the global namespace, next to the enum and before any use of
+/// EnumTraits<TEnum>.
+#define ENUM_TRAITS_DECLARE(TEnum)                                                                           \
+    namespace etraits {                                                                                      \
+    template <>                                                                                              \
+    const detail::EnumExternData<TEnum> ExternEnumTraits<TEnum>::tables;                                     \
+    template <>                                                                                              \
+    struct EnumTraits<TEnum> : ExternEnumTraits<TEnum> {};                                                   \
+    }
+
+/// Builds the reflection tables of an enum declared with ENUM_TRAITS_DECLARE. Must be used exactly once,
+/// in the global namespace of a single translation unit.
+#define ENUM_TRAITS_DEFINE(TEnum)                                                                            \
+    namespace etraits {                                                                                      \
+    template <>                                                                                              \
+    const detail::EnumExternData<TEnum> ExternEnumTraits<TEnum>::tables =                                    \
+        detail::EnumExternBuilder<TEnum>::get();                                                             \
+    }
+
+#endif // ENUM_TRAITS_ENUM_EXTERN_HPP_
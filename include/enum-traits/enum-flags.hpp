@@ -0,0 +1,249 @@
+#ifndef ENUM_TRAITS_ENUM_FLAGS_HPP_
+#define ENUM_TRAITS_ENUM_FLAGS_HPP_
+
+#include "enum-traits/enum-traits.hpp"
+
+#include <climits>
+#include <cstring>
+
+namespace etraits {
+
+namespace detail {
+    /// Reflection of bit-flag enums: only the single-bit values (and zero) of the underlying type are
+    /// probed, so `1 << 63` costs as much as `1 << 0`
+    template <typename TEnum>
+    struct EnumBits {
+        using type = typename std::underlying_type<TEnum>::type;
+        using UnsignedType = typename std::make_unsigned<type>::type;
+
+        static constexpr std::size_t bitCount = sizeof(type) * CHAR_BIT;
+
+        static constexpr type bitValue(const std::size_t bit) noexcept {
+            return static_cast<type>(static_cast<UnsignedType>(static_cast<std::uintmax_t>(1) << bit));
+        }
+
+        template <std::size_t... I>
+        static constexpr Table<bool, bitCount> probe(std::index_sequence<I...>) noexcept {
+            return { { validateEnum<TEnum, static_cast<TEnum>(bitValue(I))>()... } };
+        }
+
+        static constexpr Table<bool, bitCount> valid = probe(std::make_index_sequence<bitCount>{});
+        static constexpr bool zeroValid = validateEnum<TEnum, static_cast<TEnum>(0)>();
+
+        static constexpr std::size_t getSize() noexcept {
+            std::size_t size = zeroValid ? 1 : 0;
+            for (std::size_t bit = 0; bit < bitCount; ++bit) {
+                size += valid[bit] ? 1 : 0;
+            }
+            return size;
+        }
+
+        static constexpr std::size_t size = getSize();
+
+        /// Value of every named flag: the single bits in ascending order followed by zero (if it is named)
+        static constexpr Table<UnsignedType, size> getMasks() noexcept {
+            Table<UnsignedType, size> masks{};
+            std::size_t k = 0;
+            for (std::size_t bit = 0; bit < bitCount; ++bit) {
+                if (valid[bit]) {
+                    masks[k++] = static_cast<UnsignedType>(bitValue(bit));
+                }
+            }
+            return masks;
+        }
+
+        static constexpr Table<UnsignedType, size> masks = getMasks();
+
+        template <std::size_t... I>
+        static constexpr std::array<StaticString, size> getParsed(std::index_sequence<I...>) noexcept {
+            return { { getName<TEnum, static_cast<TEnum>(static_cast<type>(masks[I]))>()... } };
+        }
+
+        static constexpr std::array<StaticString, size> parsed = getParsed(std::make_index_sequence<size>{});
+
+        using IndexType = SmallestUnsigned<size>;
+
+        /// Position of the name of every bit in `masks`, or `size` for bits without a name
+        static constexpr Table<IndexType, bitCount> getBitNames() noexcept {
+            Table<IndexType, bitCount> bitNames{};
+            for (std::size_t bit = 0, k = 0; bit < bitCount; ++bit) {
+                bitNames[bit] = static_cast<IndexType>(valid[bit] ? k++ : size);
+            }
+            return bitNames;
+        }
+
+        static constexpr Table<IndexType, bitCount> bitNames = getBitNames();
+
+        static constexpr UnsignedType getMask() noexcept {
+            UnsignedType mask = 0;
+            for (std::size_t i = 0; i < size; ++i) {
+                mask = static_cast<UnsignedType>(mask | masks[i]);
+            }
+            return mask;
+        }
+
+        static constexpr UnsignedType mask = getMask();
+    };
+
+    template <typename TEnum>
+    constexpr Table<typename EnumBits<TEnum>::UnsignedType, EnumBits<TEnum>::size> EnumBits<TEnum>::masks;
+
+    template <typename TEnum>
+    constexpr Table<typename EnumBits<TEnum>::IndexType, EnumBits<TEnum>::bitCount> EnumBits<TEnum>::bitNames;
+
+    template <typename TEnum>
+    using EnumBitNames = NamePool<EnumBits<TEnum>>;
+
+    template <typename TEnum, std::size_t... I>
+    constexpr std::array<TEnum, sizeof...(I)> getFlagValues(std::index_sequence<I...>) noexcept {
+        return { { static_cast<TEnum>(EnumBits<TEnum>::masks[I])... } };
+    }
+
+    template <typename TEnum, std::size_t... I>
+    constexpr std::array<StringView, sizeof...(I)> getFlagNames(std::index_sequence<I...>) noexcept {
+        return { { EnumBitNames<TEnum>::get(I)... } };
+    }
+} // namespace detail
+
+/// Formatting and parsing of bit-flag enums, e.g. `Read|Write`.
+/// Combinations are formatted from a per-bit name table; bits without a name are written as a single
+/// hexadecimal number (e.g. `Read|0x30`), which parse() accepts as well.
+template <typename T>
+struct EnumFlags {
+    using UnderlyingType = typename std::underlying_type<T>::type;
+    using ValueType = T;
+
+    /// Bitwise OR of all named flags
+    static constexpr UnderlyingType mask() noexcept {
+        return static_cast<UnderlyingType>(detail::EnumBits<T>::mask);
+    }
+
+    /// All named flags in ascending order, followed by the zero value if it has a name
+    static constexpr std::array<T, detail::EnumBits<T>::size> values() noexcept {
+        return detail::getFlagValues<T>(std::make_index_sequence<detail::EnumBits<T>::size>{});
+    }
+
+    static constexpr std::array<StringView, detail::EnumBits<T>::size> names() noexcept {
+        return detail::getFlagNames<T>(std::make_index_sequence<detail::EnumBits<T>::size>{});
+    }
+
+    /// Writes the names of all flags set in `value` separated by '|' into `out` (not NUL-terminated).
+    /// Returns the length of the whole text; when it is greater than `capacity`, only the first
+    /// `capacity` characters have been written.
+    static std::size_t format(const T value, char* out, const std::size_t capacity) noexcept {
+        using Bits = detail::EnumBits<T>;
+        using Names = detail::EnumBitNames<T>;
+        using UnsignedType = typename Bits::UnsignedType;
+
+        std::size_t size = 0;
+        const auto append = [&](const char* data, const std::size_t length) {
+            if (size < capacity) {
+                std::memcpy(out + size, data, std::min(length, capacity - size));
+            }
+            size += length;
+        };
+
+        UnsignedType bits = static_cast<UnsignedType>(value);
+        if (bits == 0 && Bits::zeroValid) {
+            const StringView name = Names::get(Bits::size - 1);
+            append(name.data(), name.size());
+            return size;
+        }
+
+        const UnsignedType unnamed = static_cast<UnsignedType>(bits & ~Bits::mask);
+        bits = static_cast<UnsignedType>(bits & Bits::mask);
+        while (bits != 0) {
+            const StringView name = Names::get(Bits::bitNames[detail::countTrailingZeros(bits)]);
+            bits = static_cast<UnsignedType>(bits & (bits - 1));
+            append("|", size == 0 ? 0 : 1);
+            append(name.data(), name.size());
+        }
+
+        if (unnamed != 0 || size == 0) {
+            char hex[2 + Bits::bitCount / 4] = { '0', 'x' };
+            std::size_t digits = 1;
+            while (digits < Bits::bitCount / 4 && (unnamed >> (digits * 4)) != 0) {
+                ++digits;
+            }
+            for (std::size_t i = 0; i < digits; ++i) {
+                hex[1 + digits - i] = "0123456789abcdef"[(unnamed >> (i * 4)) & 0xF];
+            }
+            append("|", size == 0 ? 0 : 1);
+            append(hex, 2 + digits);
+        }
+        return size;
+    }
+
+    /// Parses flag names separated by '|' (optionally surrounded by spaces) into `out`.
+    /// Returns false if any of the names is unknown, in which case `out` is left untouched.
+    static bool parse(const char* str, const std::size_t size, T& out) noexcept {
+        typename detail::EnumBits<T>::UnsignedType result = 0;
+        for (std::size_t begin = 0;;) {
+            std::size_t end = begin;
+            while (end < size && str[end] != '|') {
+                ++end;
+            }
+            std::size_t first = begin;
+            std::size_t last = end;
+            while (first < last && str[first] == ' ') {
+                ++first;
+            }
+            while (last > first && str[last - 1] == ' ') {
+                --last;
+            }
+            typename detail::EnumBits<T>::UnsignedType bits = 0;
+            if (!parseFlag(str + first, last - first, bits)) {
+                return false;
+            }
+            result = static_cast<decltype(result)>(result | bits);
+            if (end == size) {
+                break;
+            }
+            begin = end + 1;
+        }
+        out = static_cast<T>(result);
+        return true;
+    }
+
+    static bool parse(const char* str, T& out) noexcept { return parse(str, std::strlen(str), out); }
+
+    static bool parse(const StringView str, T& out) noexcept { return parse(str.data(), str.size(), out); }
+
+private:
+    static bool parseFlag(const char* str,
+                          const std::size_t size,
+                          typename detail::EnumBits<T>::UnsignedType& bits) noexcept {
+        using Bits = detail::EnumBits<T>;
+        using Lookup = detail::PerfectHash<detail::EnumBitNames<T>>;
+
+        if (size > 2 && str[0] == '0' && (str[1] == 'x' || str[1] == 'X')) {
+            if (size - 2 > Bits::bitCount / 4) {
+                return false;
+            }
+            bits = 0;
+            for (std::size_t i = 2; i < size; ++i) {
+                const char c = str[i];
+                const int digit = c >= '0' && c <= '9'   ? c - '0'
+                                  : c >= 'a' && c <= 'f' ? c - 'a' + 10
+                                  : c >= 'A' && c <= 'F' ? c - 'A' + 10
+                                                         : -1;
+                if (digit < 0) {
+                    return false;
+                }
+                bits = static_cast<typename Bits::UnsignedType>((bits << 4) | static_cast<unsigned>(digit));
+            }
+            return true;
+        }
+
+        const std::size_t index = Lookup::find(str, size, detail::hashString(str, size));
+        if (index == Lookup::size) {
+            return false;
+        }
+        bits = Bits::masks[index];
+        return true;
+    }
+};
+
+} // namespace etraits
+
+#endif // ENUM_TRAITS_ENUM_FLAGS_HPP_
@@ -0,0 +1,211 @@
+#ifndef ENUM_TRAITS_ENUM_STATS_HPP_
+#define ENUM_TRAITS_ENUM_STATS_HPP_
+
+#include "enum-traits/enum-traits.hpp"
+
+#include <atomic>
+#include <chrono>
+#include <ostream>
+
+#ifndef ENUM_TRAITS_STATS_SHARDS
+#define ENUM_TRAITS_STATS_SHARDS 16
+#endif
+
+namespace etraits {
+
+/// Number of buckets of the latency histogram: bucket b counts the lookups which took [2^b, 2^(b+1))
+/// nanoseconds, the last one also everything slower
+static constexpr std::size_t LatencyBuckets = 24;
+
+/// Counters of one enum, summed over all threads
+struct EnumStatsSnapshot {
+    StringView type;           ///< name of the enum type
+    std::uint64_t hits = 0;    ///< fromStr() calls which found a value and name() calls with a valid value
+    std::uint64_t misses = 0;  ///< fromStr() calls which returned Invalid
+    std::uint64_t invalid = 0; ///< name() calls with a value which is not valid (returning "")
+    std::array<std::uint64_t, LatencyBuckets> latency{}; ///< sampled fromStr() latencies
+};
+
+namespace detail {
+    /// The counters of one enum updated by a group of threads, padded to its own cache lines so that the
+    /// threads of different shards never write to the same line
+    struct alignas(64) EnumStatsShard {
+        std::atomic<std::uint64_t> events[3];
+        std::atomic<std::uint64_t> latency[LatencyBuckets];
+    };
+
+    /// Shard of the calling thread; threads are assigned to shards round-robin
+    inline std::size_t threadShard() noexcept {
+        static std::atomic<std::size_t> next{ 0 };
+        thread_local const std::size_t shard = next.fetch_add(1, std::memory_order_relaxed) %
+                                               ENUM_TRAITS_STATS_SHARDS;
+        return shard;
+    }
+
+    /// An enum with counters, linked into the registry by its first counted call
+    struct EnumStatsEntry {
+        StringView type;
+        const EnumStatsShard* shards;
+        EnumStatsEntry* next;
+    };
+
+    inline std::atomic<EnumStatsEntry*>& statsRegistry() noexcept {
+        static std::atomic<EnumStatsEntry*> head{ nullptr };
+        return head;
+    }
+
+    inline bool registerStats(EnumStatsEntry& entry) noexcept {
+        std::atomic<EnumStatsEntry*>& head = statsRegistry();
+        entry.next = head.load(std::memory_order_relaxed);
+        while (!head.compare_exchange_weak(entry.next, &entry, std::memory_order_release,
+                                           std::memory_order_relaxed)) {
+        }
+        return true;
+    }
+
+    inline EnumStatsSnapshot sumStats(const StringView type, const EnumStatsShard* shards) noexcept {
+        EnumStatsSnapshot snapshot;
+        snapshot.type = type;
+        for (std::size_t s = 0; s < ENUM_TRAITS_STATS_SHARDS; ++s) {
+            const EnumStatsShard& shard = shards[s];
+            snapshot.hits += shard.events[0].load(std::memory_order_relaxed);
+            snapshot.misses += shard.events[1].load(std::memory_order_relaxed);
+            snapshot.invalid += shard.events[2].load(std::memory_order_relaxed);
+            for (std::size_t b = 0; b < LatencyBuckets; ++b) {
+                snapshot.latency[b] += shard.latency[b].load(std::memory_order_relaxed);
+            }
+        }
+        return snapshot;
+    }
+
+    /// Name of the type T as spelled in the signature, e.g. "Fruits" or "Foo::Fruits"
+    template <typename T>
+    StringView getTypeName() noexcept {
+#if defined(__clang__) || defined(__GNUC__) || defined(__GNUG__)
+        const char* signature = __PRETTY_FUNCTION__;
+        const std::size_t size = sizeof(__PRETTY_FUNCTION__) - 1;
+        std::size_t begin = 0;
+        while (begin + 4 <= size && !(signature[begin] == 'T' && signature[begin + 1] == ' ' &&
+                                      signature[begin + 2] == '=' && signature[begin + 3] == ' ')) {
+            ++begin;
+        }
+        begin += 4;
+        std::size_t end = begin;
+        while (end < size && signature[end] != ';' && signature[end] != ']') {
+            ++end;
+        }
+#elif defined(_MSC_VER)
+        const char* signature = __FUNCSIG__;
+        const std::size_t size = sizeof(__FUNCSIG__) - 1;
+        std::size_t begin = 0;
+        while (begin < size && signature[begin] != '<') {
+            ++begin;
+        }
+        begin += 1;
+        std::size_t end = size - 16; // ">(void) noexcept"
+        for (const char* prefix : { "enum ", "class " }) {
+            const std::size_t length = cstrlen(prefix);
+            if (StringView(signature + begin, std::min(length, end - begin)) == prefix) {
+                begin += length;
+            }
+        }
+#else
+#error "Unknown compiler - not supported"
+#endif
+        return begin < end ? StringView(signature + begin, end - begin) : StringView();
+    }
+
+#if ENUM_TRAITS_INSTRUMENTATION
+    template <typename TEnum>
+    struct EnumStats {
+        // zero-initialized before any dynamic initialization, so counting works during static initialization
+        static EnumStatsShard shards[ENUM_TRAITS_STATS_SHARDS];
+
+        static bool registerOnce() noexcept {
+            static EnumStatsEntry entry = { getTypeName<TEnum>(), shards, nullptr };
+            return registerStats(entry);
+        }
+
+        static EnumStatsShard& shard() noexcept {
+            static const bool registered = registerOnce();
+            static_cast<void>(registered);
+            return shards[threadShard()];
+        }
+
+        static void record(const EnumEvent event, const std::uint64_t count = 1) noexcept {
+            shard().events[static_cast<std::size_t>(event)].fetch_add(count, std::memory_order_relaxed);
+        }
+
+        /// Time of the start of a lookup in nanoseconds if it is sampled, 0 otherwise
+        static std::uint64_t startLookup() noexcept {
+#if ENUM_TRAITS_LATENCY_SAMPLING > 0
+            thread_local std::uint32_t countdown = 0;
+            if (countdown-- != 0) {
+                return 0;
+            }
+            countdown = ENUM_TRAITS_LATENCY_SAMPLING - 1;
+            return now();
+#else
+            return 0;
+#endif
+        }
+
+        static void finishLookup(const bool hit, const std::uint64_t start) noexcept {
+            EnumStatsShard& current = shard();
+            current.events[static_cast<std::size_t>(hit ? EnumEvent::Hit : EnumEvent::Miss)].fetch_add(
+                1, std::memory_order_relaxed);
+            if (start != 0) {
+                std::uint64_t elapsed = now() - start;
+                std::size_t bucket = 0;
+                for (; elapsed > 1 && bucket + 1 < LatencyBuckets; elapsed >>= 1) {
+                    ++bucket;
+                }
+                current.latency[bucket].fetch_add(1, std::memory_order_relaxed);
+            }
+        }
+
+        static std::uint64_t now() noexcept {
+            const auto time = std::chrono::steady_clock::now().time_since_epoch();
+            // never 0, which marks lookups which are not timed
+            return static_cast<std::uint64_t>(std::chrono::nanoseconds(time).count()) | 1;
+        }
+    };
+
+    template <typename TEnum>
+    EnumStatsShard EnumStats<TEnum>::shards[ENUM_TRAITS_STATS_SHARDS];
+#endif
+} // namespace detail
+
+/// Counters of TEnum; all zero while ENUM_TRAITS_INSTRUMENTATION is not set
+template <typename TEnum>
+EnumStatsSnapshot enumStats() noexcept {
+#if ENUM_TRAITS_INSTRUMENTATION
+    return detail::sumStats(detail::getTypeName<TEnum>(), detail::EnumStats<TEnum>::shards);
+#else
+    EnumStatsSnapshot snapshot;
+    snapshot.type = detail::getTypeName<TEnum>();
+    return snapshot;
+#endif
+}
+
+/// Calls `visitor` with the EnumStatsSnapshot of every enum whose name() or fromStr() has been called.
+/// Safe to call while other threads keep counting.
+template <typename TVisitor>
+void forEachEnumStats(TVisitor&& visitor) {
+    const detail::EnumStatsEntry* entry = detail::statsRegistry().load(std::memory_order_acquire);
+    for (; entry != nullptr; entry = entry->next) {
+        visitor(detail::sumStats(entry->type, entry->shards));
+    }
+}
+
+/// Writes one line per counted enum, e.g. "Fruits: hits=10 misses=2 invalid=0"
+inline void dumpEnumStats(std::ostream& out) {
+    forEachEnumStats([&out](const EnumStatsSnapshot& stats) {
+        out.write(stats.type.data(), static_cast<std::streamsize>(stats.type.size()));
+        out << ": hits=" << stats.hits << " misses=" << stats.misses << " invalid=" << stats.invalid << '\n';
+    });
+}
+
+} // namespace etraits
+
+#endif // ENUM_TRAITS_ENUM_STATS_HPP_
@@ -0,0 +1,33 @@
+#ifndef ENUM_TRAITS_ENUM_STREAM_HPP_
+#define ENUM_TRAITS_ENUM_STREAM_HPP_
+
+#include "enum-traits/enum-traits.hpp"
+
+#include <ostream>
+
+namespace etraits {
+
+/// Writes the characters of `str` with a single write() call, without looking for a NUL
+inline std::ostream& operator<<(std::ostream& os, const StringView str) {
+    return os.write(str.data(), static_cast<std::streamsize>(str.size()));
+}
+
+/// Stream adaptor writing the name of an enum value straight from the name pool, see nameOf()
+template <typename T>
+struct EnumName {
+    T value;
+
+    friend std::ostream& operator<<(std::ostream& os, const EnumName name) {
+        return os << EnumTraits<T>::name(name.value);
+    }
+};
+
+/// `std::cout << nameOf(Fruits::Pears)` prints `Pears` (and nothing for invalid values)
+template <typename T>
+constexpr EnumName<T> nameOf(const T value) noexcept {
+    return EnumName<T>{ value };
+}
+
+} // namespace etraits
+
+#endif // ENUM_TRAITS_ENUM_STREAM_HPP_
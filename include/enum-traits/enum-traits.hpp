@@ -3,6 +3,9 @@
 
 #include <algorithm>
 #include <array>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
 #include <limits>
 #include <type_traits>
 
@@ -22,10 +25,61 @@
 #error "Unknown compiler - not supported"
 #endif
 
+#if defined(_MSVC_LANG) && _MSVC_LANG > __cplusplus
+#define ENUM_TRAITS_CPLUSPLUS _MSVC_LANG
+#else
+#define ENUM_TRAITS_CPLUSPLUS __cplusplus
+#endif
+
+#if ENUM_TRAITS_CPLUSPLUS >= 201703L
+#define ENUM_TRAITS_HAS_CPP17 1
+#include <string_view>
+#else
+#define ENUM_TRAITS_HAS_CPP17 0
+#endif
+
+/// Functions which only build tables for static constexpr members are immediate functions in C++20
+#if ENUM_TRAITS_CPLUSPLUS >= 202002L && defined(__cpp_consteval)
+#define ENUM_TRAITS_CONSTEVAL consteval
+#else
+#define ENUM_TRAITS_CONSTEVAL constexpr
+#endif
+
 #ifndef ENUM_TRAITS_MAX_NAME_LENGTH
 #define ENUM_TRAITS_MAX_NAME_LENGTH 64
 #endif
 
+/// When set to 1, fromStr() and name() count their hits, misses and invalid values per enum (see
+/// enum-traits/enum-stats.hpp). Lookups evaluated at compile time are not counted; that needs
+/// __builtin_is_constant_evaluated (gcc 9, clang 9, MSVC 19.25), without it the lookups cannot be used
+/// in constant expressions while the instrumentation is on.
+#ifndef ENUM_TRAITS_INSTRUMENTATION
+#define ENUM_TRAITS_INSTRUMENTATION 0
+#endif
+
+#if defined(__has_builtin)
+#if __has_builtin(__builtin_is_constant_evaluated)
+#define ENUM_TRAITS_HAS_CONSTANT_EVALUATED 1
+#endif
+#elif (defined(__GNUC__) && !defined(__clang__)) || (defined(_MSC_VER) && _MSC_VER >= 1925)
+#define ENUM_TRAITS_HAS_CONSTANT_EVALUATED 1
+#endif
+#ifndef ENUM_TRAITS_HAS_CONSTANT_EVALUATED
+#define ENUM_TRAITS_HAS_CONSTANT_EVALUATED 0
+#endif
+
+/// With ENUM_TRAITS_INSTRUMENTATION, one in this many fromStr() calls of every thread is timed for the
+/// latency histogram; 0 disables the timing
+#ifndef ENUM_TRAITS_LATENCY_SAMPLING
+#define ENUM_TRAITS_LATENCY_SAMPLING 0
+#endif
+
+/// When set to 1, enums with a byte-sized underlying type (uint8_t, int8_t, char, ...) scan their whole
+/// domain by default instead of ENUM_TRAITS_MIN_ENUM_VALUE to ENUM_TRAITS_MAX_ENUM_VALUE
+#ifndef ENUM_TRAITS_FULL_BYTE_RANGE
+#define ENUM_TRAITS_FULL_BYTE_RANGE 1
+#endif
+
 #ifndef ENUM_TRAITS_MIN_ENUM_VALUE
 #define ENUM_TRAITS_MIN_ENUM_VALUE std::numeric_limits<int8_t>::min()
 #endif
@@ -37,8 +91,66 @@
 namespace etraits {
 
 namespace detail {
+    constexpr std::size_t cstrlen(const char* str) noexcept {
+        std::size_t size = 0;
+        while (str[size] != 0) {
+            ++size;
+        }
+        return size;
+    }
+
     constexpr bool cstreq(const char* a, const char* b) noexcept {
-        return *a == *b && (*a == 0 || cstreq(a + 1, b + 1));
+        for (; *a == *b; ++a, ++b) {
+            if (*a == 0) {
+                return true;
+            }
+        }
+        return false;
+    }
+
+#if ENUM_TRAITS_INSTRUMENTATION
+    constexpr bool isConstantEvaluated() noexcept {
+#if ENUM_TRAITS_HAS_CONSTANT_EVALUATED
+        return __builtin_is_constant_evaluated();
+#else
+        return false;
+#endif
+    }
+
+    enum class EnumEvent { Hit, Miss, Invalid };
+
+    /// Counters of TEnum, defined in enum-traits/enum-stats.hpp
+    template <typename TEnum>
+    struct EnumStats;
+#endif
+
+    /// `value` clamped to the range of TType. The result type holds both every TValue and every TType, so
+    /// the limits of uint8_t survive even if TValue is int8_t.
+    template <typename TType, typename TValue>
+    constexpr typename std::common_type<TValue, TType>::type clampTo(const TValue value) noexcept {
+        using Limits = std::numeric_limits<TType>;
+        using Result = typename std::common_type<TValue, TType>::type;
+        if (std::is_signed<TValue>::value && value < 0) {
+            const bool fits = Limits::is_signed &&
+                              static_cast<std::intmax_t>(value) >= static_cast<std::intmax_t>(Limits::min());
+            return fits ? static_cast<Result>(value) : static_cast<Result>(Limits::min());
+        }
+        return static_cast<std::uintmax_t>(value) <= static_cast<std::uintmax_t>(Limits::max())
+                   ? static_cast<Result>(value)
+                   : static_cast<Result>(Limits::max());
+    }
+
+    /// Default bound of the scanned range of an enum with the underlying type TType: `value` clamped to
+    /// TType, or the limit of TType itself for byte-sized types (see ENUM_TRAITS_FULL_BYTE_RANGE), whose
+    /// 256 values are probed in a single block
+    template <typename TType, typename TValue>
+    constexpr typename std::common_type<TValue, TType>::type
+    defaultBound(const TValue value, const bool lower) noexcept {
+        using Limits = std::numeric_limits<TType>;
+        using Result = typename std::common_type<TValue, TType>::type;
+        return ENUM_TRAITS_FULL_BYTE_RANGE && sizeof(TType) == 1
+                   ? static_cast<Result>(lower ? Limits::min() : Limits::max())
+                   : clampTo<TType>(value);
     }
 } // namespace detail
 
@@ -71,6 +183,8 @@ public:
 
     constexpr const T* c_str() const noexcept { return mData.data(); }
 
+    constexpr T operator[](const std::size_t i) const noexcept { return mData[i]; }
+
 private:
     std::array<T, TMaxSize> mData;
 };
@@ -107,32 +221,309 @@ constexpr bool operator!=(const SizedString<T, TSize1>& lhs, const SizedString<T
 
 using StaticString = SizedString<char, ENUM_TRAITS_MAX_NAME_LENGTH>;
 
+/// Non-owning view of a string with a precomputed length. Views of reflected names always point to
+/// NUL-terminated storage, so c_str() may be used on them.
+class StringView {
+public:
+    constexpr StringView() noexcept
+        : mData("")
+        , mSize(0) {}
+
+    constexpr StringView(const char* data, const std::size_t size) noexcept
+        : mData(data)
+        , mSize(size) {}
+
+    constexpr const char* data() const noexcept { return mData; }
+
+    constexpr const char* c_str() const noexcept { return mData; }
+
+    constexpr std::size_t size() const noexcept { return mSize; }
+
+    constexpr bool empty() const noexcept { return mSize == 0; }
+
+    constexpr const char* begin() const noexcept { return mData; }
+
+    constexpr const char* end() const noexcept { return mData + mSize; }
+
+    constexpr char operator[](const std::size_t i) const noexcept { return mData[i]; }
+
+private:
+    const char* mData;
+    std::size_t mSize;
+};
+
+constexpr bool operator==(const StringView lhs, const char* rhs) noexcept {
+    for (std::size_t i = 0; i < lhs.size(); ++i) {
+        if (lhs[i] != rhs[i]) {
+            return false;
+        }
+    }
+    return rhs[lhs.size()] == 0;
+}
+
+constexpr bool operator!=(const StringView lhs, const char* rhs) noexcept {
+    return !(lhs == rhs);
+}
+
+constexpr bool operator==(const char* lhs, const StringView rhs) noexcept {
+    return rhs == lhs;
+}
+
+constexpr bool operator!=(const char* lhs, const StringView rhs) noexcept {
+    return !(rhs == lhs);
+}
+
+constexpr bool operator==(const StringView lhs, const StringView rhs) noexcept {
+    if (lhs.size() != rhs.size()) {
+        return false;
+    }
+    for (std::size_t i = 0; i < lhs.size(); ++i) {
+        if (lhs[i] != rhs[i]) {
+            return false;
+        }
+    }
+    return true;
+}
+
+constexpr bool operator!=(const StringView lhs, const StringView rhs) noexcept {
+    return !(lhs == rhs);
+}
+
+/// Read-only view of a contiguous array
+template <typename T>
+class ArrayView {
+public:
+    using value_type = T;
+    using size_type = std::size_t;
+    using const_reference = const T&;
+    using const_iterator = const T*;
+    using iterator = const T*;
+
+    constexpr ArrayView(const T* data, const std::size_t size) noexcept
+        : mData(data)
+        , mSize(size) {}
+
+    constexpr const T* data() const noexcept { return mData; }
+
+    constexpr std::size_t size() const noexcept { return mSize; }
+
+    constexpr bool empty() const noexcept { return mSize == 0; }
+
+    constexpr const T* begin() const noexcept { return mData; }
+
+    constexpr const T* end() const noexcept { return mData + mSize; }
+
+    constexpr const T& operator[](const std::size_t i) const noexcept { return mData[i]; }
+
+private:
+    const T* mData;
+    std::size_t mSize;
+};
+
+/// The values of an enum whose valid values are contiguous, computed from the lowest one instead of
+/// being stored, see EnumTraits::values()
+template <typename T>
+class ContiguousValues {
+public:
+    using UnderlyingType = typename std::underlying_type<T>::type;
+
+    class Iterator {
+    public:
+        // the values are computed, so there is nothing a reference could point to and the iterator can
+        // only be an input iterator
+        using iterator_category = std::input_iterator_tag;
+        using value_type = T;
+        using difference_type = std::ptrdiff_t;
+        using pointer = void;
+        using reference = T;
+
+        constexpr explicit Iterator(const std::uintmax_t value) noexcept
+            : mValue(value) {}
+
+        constexpr T operator*() const noexcept { return static_cast<T>(static_cast<UnderlyingType>(mValue)); }
+
+        constexpr Iterator& operator++() noexcept {
+            ++mValue;
+            return *this;
+        }
+
+        constexpr Iterator operator++(int) noexcept {
+            Iterator copy = *this;
+            ++mValue;
+            return copy;
+        }
+
+        constexpr bool operator==(const Iterator& other) const noexcept { return mValue == other.mValue; }
+        constexpr bool operator!=(const Iterator& other) const noexcept { return mValue != other.mValue; }
+
+    private:
+        std::uintmax_t mValue;
+    };
+
+    using value_type = T;
+    using size_type = std::size_t;
+    using const_iterator = Iterator;
+    using iterator = Iterator;
+
+    constexpr ContiguousValues(const UnderlyingType first, const std::size_t size) noexcept
+        : mFirst(static_cast<std::uintmax_t>(first))
+        , mSize(size) {}
+
+    constexpr std::size_t size() const noexcept { return mSize; }
+
+    constexpr bool empty() const noexcept { return mSize == 0; }
+
+    constexpr Iterator begin() const noexcept { return Iterator(mFirst); }
+
+    constexpr Iterator end() const noexcept { return Iterator(mFirst + mSize); }
+
+    constexpr T operator[](const std::size_t i) const noexcept {
+        return static_cast<T>(static_cast<UnderlyingType>(mFirst + i));
+    }
+
+private:
+    std::uintmax_t mFirst;
+    std::size_t mSize;
+};
+
+/// Options of the lenient EnumTraits::fromStr() overloads, see ParsePolicy
+enum ParseOptions : unsigned {
+    IgnoreCase = 1,        ///< ASCII letters match regardless of their case
+    IgnoreUnderscores = 2, ///< '_' is skipped, so (with IgnoreCase) "apple_pie" matches ApplePie
+    StripCommonPrefix = 4, ///< the prefix shared by all names (e.g. "kColor" of kColorRed) is not matched
+};
+
+/// Selects the lenient EnumTraits::fromStr() overloads. TOptions is a combination of ParseOptions.
+/// The optional `prefix` is skipped at the start of the input (if it is there), e.g. "FRUITS_" of
+/// "FRUITS_APPLES"; it is compared with the same options.
+template <unsigned TOptions>
+class ParsePolicy {
+public:
+    static constexpr unsigned options = TOptions;
+
+    constexpr ParsePolicy() noexcept = default;
+
+    constexpr explicit ParsePolicy(const StringView prefix) noexcept
+        : mPrefix(prefix) {}
+
+    constexpr explicit ParsePolicy(const char* prefix) noexcept
+        : mPrefix(prefix, detail::cstrlen(prefix)) {}
+
+    constexpr StringView prefix() const noexcept { return mPrefix; }
+
+private:
+    StringView mPrefix;
+};
+
+/// Range of values [min, max] scanned for the enumerators of T. Defaults to the whole domain of byte-sized
+/// underlying types and to ENUM_TRAITS_MIN_ENUM_VALUE to ENUM_TRAITS_MAX_ENUM_VALUE clamped to the range
+/// of the underlying type of T otherwise; specialize it (or use ENUM_TRAITS_RANGE) to scan a tighter or a
+/// wider range for a single enum.
+template <typename T>
+struct EnumRangeTraits {
+    static constexpr auto min =
+        detail::defaultBound<typename std::underlying_type<T>::type>(ENUM_TRAITS_MIN_ENUM_VALUE, true);
+    static constexpr auto max =
+        detail::defaultBound<typename std::underlying_type<T>::type>(ENUM_TRAITS_MAX_ENUM_VALUE, false);
+};
+
+/// A window of values [TMin, TMax] scanned for enumerators, see EnumWindows
+template <std::intmax_t TMin, std::intmax_t TMax>
+struct EnumWindow {
+    static constexpr std::intmax_t min = TMin;
+    static constexpr std::intmax_t max = TMax;
+};
+
+/// Base of an EnumRangeTraits specialization scanning several windows instead of the whole [min, max]
+/// range, for enums with clusters of values far apart (or use ENUM_TRAITS_WINDOWS). The windows must be
+/// sorted and must not overlap. Only the windows are probed and the lookups go through a window ->
+/// offset table, so the gaps between the windows cost nothing.
+template <typename TFirst, typename... TOthers>
+struct EnumWindows {
+    using Windows = EnumWindows;
+
+    static constexpr std::intmax_t min = TFirst::min;
+    static constexpr std::intmax_t max = std::max({ TFirst::max, TOthers::max... });
+};
+
+/// An extra spelling accepted for `value` by the lookups of EnumTraits, see EnumAliasTraits
+template <typename T>
+struct EnumAlias {
+    const char* name;
+    T value;
+};
+
+/// Extra names of the values of T, such as legacy or deprecated spellings. There are none by default;
+/// specialize it with a `static constexpr EnumAlias<T> aliases[]` member (or use ENUM_TRAITS_ALIASES).
+/// The aliases are keys of the perfect hash and of the sorted names, so fromStr(), fromStrBatch(),
+/// withPrefix() and fromStrPrefix() accept them at no extra cost. name() still returns the enumerator name.
+template <typename T>
+struct EnumAliasTraits {};
+
 namespace detail {
     static constexpr std::size_t StringNpos = 0xFFFFFFFF;
 
+    /// Fixed-size array usable as a constexpr-built lookup table (C++14 std::array lacks constexpr writes)
+    template <typename T, std::size_t TSize>
+    struct Table {
+        T data[TSize > 0 ? TSize : 1];
+
+        constexpr T& operator[](const std::size_t i) noexcept { return data[i]; }
+        constexpr const T& operator[](const std::size_t i) const noexcept { return data[i]; }
+        static constexpr std::size_t size() noexcept { return TSize; }
+    };
+
+    /// `value` must not be 0
+    inline std::size_t countTrailingZeros(const std::uint64_t value) noexcept {
+#if defined(__clang__) || defined(__GNUC__) || defined(__GNUG__)
+        return static_cast<std::size_t>(__builtin_ctzll(value));
+#else
+        std::size_t count = 0;
+        while (((value >> count) & 1) == 0) {
+            ++count;
+        }
+        return count;
+#endif
+    }
+
+    inline std::size_t popCount(std::uint64_t value) noexcept {
+#if defined(__clang__) || defined(__GNUC__) || defined(__GNUG__)
+        return static_cast<std::size_t>(__builtin_popcountll(value));
+#else
+        std::size_t count = 0;
+        for (; value != 0; value &= value - 1) {
+            ++count;
+        }
+        return count;
+#endif
+    }
+
+    template <std::size_t TMax>
+    using SmallestUnsigned = typename std::conditional<
+        (TMax <= std::numeric_limits<uint8_t>::max()),
+        uint8_t,
+        typename std::conditional<(TMax <= std::numeric_limits<uint16_t>::max()), uint16_t, uint32_t>::type>::
+        type;
+
     template <std::size_t TSize>
     constexpr std::size_t find(char const (&str)[TSize], const char c, const std::size_t pos = 0) noexcept {
-        return pos < TSize ? (str[pos] == c ? pos : find(str, c, pos + 1)) : StringNpos;
+        for (std::size_t i = pos; i < TSize; ++i) {
+            if (str[i] == c) {
+                return i;
+            }
+        }
+        return StringNpos;
     }
 
     template <std::size_t TSize>
     constexpr std::size_t
     rfind(char const (&str)[TSize], const char c, const std::size_t pos = StringNpos) noexcept {
-        // clang-format off
-        return pos == 0 ? (str[std::min(pos, TSize - 1)] == c ? pos : StringNpos)
-                        : str[std::min(pos, TSize - 1)] == c ? std::min(pos, TSize - 1) : rfind(str, c, std::min(pos, TSize - 1) - 1);
-        // clang-format on
-    }
-
-    template <std::size_t TSize, std::size_t TOtherSize>
-    constexpr bool findSubstr(char const (&str)[TSize],
-                              std::size_t index,
-                              std::size_t index2,
-                              char const (&substr)[TOtherSize]) noexcept {
-        // clang-format off
-        return index2 == TOtherSize - 1 ? true :
-            (index < TSize ? (str[index] == substr[index2] ? findSubstr(str, index + 1, index2 + 1, substr) : false) : false);
-        // clang-format on
+        for (std::size_t i = std::min(pos, TSize - 1) + 1; i-- > 0;) {
+            if (str[i] == c) {
+                return i;
+            }
+        }
+        return StringNpos;
     }
 
     template <std::size_t TSize,
@@ -140,21 +531,41 @@ namespace detail {
               typename std::enable_if<(TOtherSize - 1 <= TSize), bool>::type = true>
     constexpr std::size_t
     find(char const (&str)[TSize], char const (&substr)[TOtherSize], const std::size_t pos = 0) noexcept {
-        return pos < TSize ? (findSubstr(str, pos, 0, substr) ? pos : find(str, substr, pos + 1))
-                           : StringNpos;
+        for (std::size_t i = pos; i + TOtherSize - 1 <= TSize; ++i) {
+            std::size_t k = 0;
+            while (k < TOtherSize - 1 && str[i + k] == substr[k]) {
+                ++k;
+            }
+            if (k == TOtherSize - 1) {
+                return i;
+            }
+        }
+        return StringNpos;
+    }
+
+    /// Checks whether the value printed at the end of a signature (right before `end`) is
+    /// an enumerator rather than a number, which is either bare (clang: "-5") or preceded by a cast
+    /// (gcc: "(Fruits)-5"). Scanning backwards only touches the few characters of the value itself.
+    template <std::size_t TSize>
+    constexpr bool isEnumeratorSpelling(char const (&str)[TSize], const std::size_t end) noexcept {
+        std::size_t pos = end;
+        while (pos > 0 && str[pos - 1] >= '0' && str[pos - 1] <= '9') {
+            --pos;
+        }
+        if (pos == end) {
+            return true;
+        }
+        if (pos > 0 && str[pos - 1] == '-') {
+            --pos;
+        }
+        return pos > 0 && str[pos - 1] != ')' && str[pos - 1] != ' ';
     }
 
     template <typename T, T TValue>
     constexpr bool validateEnum() noexcept {
 #if defined(__clang__) || defined(__GNUC__) || defined(__GNUG__)
-        constexpr std::size_t start = find(__PRETTY_FUNCTION__, "TValue = ") + 9;
-        static_assert(start != StringNpos, "Unexpected __PRETTY_FUNCTION__ output");
-#endif
-#if defined(__clang__)
-        constexpr char valueStart = __PRETTY_FUNCTION__[start];
-        return (valueStart != '-' && !(valueStart >= '0' && valueStart <= '9'));
-#elif defined(__GNUC__) || defined(__GNUG__)
-        return find(__PRETTY_FUNCTION__, '(', start) == StringNpos;
+        constexpr bool valid = isEnumeratorSpelling(__PRETTY_FUNCTION__, sizeof(__PRETTY_FUNCTION__) - 2);
+        return valid;
 #elif defined(_MSC_VER)
         constexpr std::size_t end = sizeof(__FUNCSIG__) - 17;
         return rfind(__FUNCSIG__, ')', end) == StringNpos;
@@ -168,158 +579,230 @@ namespace detail {
         static constexpr bool value = validateEnum<T, TValue>();
     };
 
-    template <typename T, typename std::underlying_type<T>::type TValue>
-    struct EnumValidIndex {
-        static constexpr bool value = EnumValid<T, static_cast<T>(TValue)>::value;
-    };
+    template <typename TType, typename TValue>
+    constexpr bool fitsInto(const TValue value) noexcept {
+        return static_cast<TValue>(static_cast<TType>(value)) == value;
+    }
 
     template <typename T>
     struct EnumLimits {
         using type = typename std::underlying_type<T>::type;
-        template <typename...,
-                  typename TType = type,
-                  typename std::enable_if<std::is_unsigned<TType>::value, bool>::type = true>
-        static constexpr type min() {
-            return 0;
-        }
 
-        template <typename...,
-                  typename TType = type,
-                  typename std::enable_if<!std::is_unsigned<TType>::value, bool>::type = true>
-        static constexpr type min() {
-            return static_cast<type>(ENUM_TRAITS_MIN_ENUM_VALUE);
-        }
+        static_assert(fitsInto<type>(EnumRangeTraits<T>::min) && fitsInto<type>(EnumRangeTraits<T>::max),
+                      "EnumRangeTraits<T> must lie within the range of the underlying type of T");
+        static_assert(static_cast<type>(EnumRangeTraits<T>::min) <=
+                          static_cast<type>(EnumRangeTraits<T>::max),
+                      "EnumRangeTraits<T>::min must not be greater than EnumRangeTraits<T>::max");
+
+        static constexpr type min() { return static_cast<type>(EnumRangeTraits<T>::min); }
 
-        static constexpr type max() { return static_cast<type>(ENUM_TRAITS_MAX_ENUM_VALUE); }
+        static constexpr type max() { return static_cast<type>(EnumRangeTraits<T>::max); }
     };
 
     template <typename T>
     using EnumType = typename EnumLimits<T>::type;
 
-    /// min
-    template <typename T, short TIndexStop, short TIndex, bool TValid>
-    struct EnumMinImpl;
+    template <typename>
+    using VoidType = void;
 
-    template <typename T, short TIndexStop, short TIndex>
-    struct EnumMinImpl<T, TIndexStop, TIndex, false> {
-        static_assert(TIndex < 128 && TIndex > -129, "");
-        static constexpr short value =
-            EnumMinImpl<T, TIndexStop, TIndex + 1, EnumValidIndex<T, TIndex + 1>::value>::value;
+    /// Windows scanned for the enumerators of T: a single [EnumLimits::min(), EnumLimits::max()] window
+    /// unless EnumRangeTraits<T> derives from EnumWindows
+    template <typename T, typename = void>
+    struct EnumWindowList {
+        static constexpr std::size_t count = 1;
+        static constexpr Table<EnumType<T>, count> mins = { { EnumLimits<T>::min() } };
+        static constexpr Table<EnumType<T>, count> maxs = { { EnumLimits<T>::max() } };
     };
 
-    template <typename T, short TIndexStop, short TIndex>
-    struct EnumMinImpl<T, TIndexStop, TIndex, true> {
-        static_assert(TIndex < 128 && TIndex > -129, "");
-        static constexpr short value = TIndex;
-    };
+    template <typename T, typename TWindows>
+    struct EnumWindowTables;
 
-    template <typename T, short TIndexStop>
-    struct EnumMinImpl<T, TIndexStop, TIndexStop, false> {
-        static constexpr short value = TIndexStop;
-    };
+    template <typename T, typename... TWindows>
+    struct EnumWindowTables<T, EnumWindows<TWindows...>> {
+        using type = EnumType<T>;
+
+        static constexpr std::size_t count = sizeof...(TWindows);
+        static constexpr Table<type, sizeof...(TWindows)> mins = { { static_cast<type>(TWindows::min)... } };
+        static constexpr Table<type, sizeof...(TWindows)> maxs = { { static_cast<type>(TWindows::max)... } };
+
+        static constexpr bool isSorted() noexcept {
+            for (std::size_t w = 0; w < count; ++w) {
+                if (mins[w] > maxs[w] || (w + 1 < count && maxs[w] >= mins[w + 1])) {
+                    return false;
+                }
+            }
+            return true;
+        }
 
-    template <typename T, short TIndexStop>
-    struct EnumMinImpl<T, TIndexStop, TIndexStop, true> {
-        static constexpr short value = TIndexStop;
+        static_assert(std::min({ fitsInto<type>(TWindows::min) && fitsInto<type>(TWindows::max)... }),
+                      "EnumWindows must lie within the range of the underlying type of T");
+        static_assert(isSorted(), "EnumWindows must be sorted and must not overlap");
     };
 
+    template <typename T, typename TVoid>
+    constexpr Table<EnumType<T>, 1> EnumWindowList<T, TVoid>::mins;
+
+    template <typename T, typename TVoid>
+    constexpr Table<EnumType<T>, 1> EnumWindowList<T, TVoid>::maxs;
+
+    template <typename T, typename... TWindows>
+    constexpr Table<EnumType<T>, sizeof...(TWindows)> EnumWindowTables<T, EnumWindows<TWindows...>>::mins;
+
+    template <typename T, typename... TWindows>
+    constexpr Table<EnumType<T>, sizeof...(TWindows)> EnumWindowTables<T, EnumWindows<TWindows...>>::maxs;
+
     template <typename T>
-    struct EnumMin {
-        static constexpr auto value =
-            static_cast<EnumType<T>>(EnumMinImpl<T,
-                                                 EnumLimits<T>::max(), // stop at max
-                                                 EnumLimits<T>::min(), // start at min
-                                                 EnumValidIndex<T, EnumLimits<T>::min()>::value>::value);
-    };
+    struct EnumWindowList<T, VoidType<typename EnumRangeTraits<T>::Windows>>
+        : EnumWindowTables<T, typename EnumRangeTraits<T>::Windows> {};
 
-    /// max
-    template <typename T, short TIndexStop, short TIndex, bool TValid>
-    struct EnumMaxImpl;
+    /// Validity of every value of the scanned windows, probed by a single flat pack expansion. Everything
+    /// else (min, max, count, values) is derived from it with plain loops.
+    /// A scan position is the offset of a value within its window plus the sizes of all lower windows.
+    template <typename TEnum>
+    struct EnumScan {
+        using type = EnumType<TEnum>;
+        using Windows = EnumWindowList<TEnum>;
 
-    template <typename T, short TIndexStop, short TIndex>
-    struct EnumMaxImpl<T, TIndexStop, TIndex, false> {
-        static_assert(TIndex < 128 && TIndex > -129, "");
-        static constexpr short value =
-            EnumMaxImpl<T, TIndexStop, TIndex - 1, EnumValidIndex<T, TIndex - 1>::value>::value;
-    };
+        static constexpr std::size_t windowSize(const std::size_t w) noexcept {
+            return static_cast<std::size_t>(static_cast<std::uintmax_t>(Windows::maxs[w]) -
+                                            static_cast<std::uintmax_t>(Windows::mins[w]) + 1);
+        }
 
-    template <typename T, short TIndexStop, short TIndex>
-    struct EnumMaxImpl<T, TIndexStop, TIndex, true> {
-        static_assert(TIndex < 128 && TIndex > -129, "");
-        static constexpr short value = TIndex;
-    };
+        static constexpr Table<std::size_t, Windows::count + 1> getStarts() noexcept {
+            Table<std::size_t, Windows::count + 1> starts{};
+            for (std::size_t w = 0; w < Windows::count; ++w) {
+                starts[w + 1] = starts[w] + windowSize(w);
+            }
+            return starts;
+        }
 
-    template <typename T, short TIndexStop>
-    struct EnumMaxImpl<T, TIndexStop, TIndexStop, false> {
-        static constexpr short value = TIndexStop;
-    };
+        /// Scan position of the first value of every window
+        static constexpr Table<std::size_t, Windows::count + 1> starts = getStarts();
+
+        static constexpr std::size_t size = starts[Windows::count];
+
+        static constexpr type valueAt(const std::size_t i) noexcept {
+            std::size_t w = 0;
+            while (i >= starts[w + 1]) {
+                ++w;
+            }
+            return static_cast<type>(static_cast<std::uintmax_t>(Windows::mins[w]) + (i - starts[w]));
+        }
+
+        /// Scan position of `value`, or a position not lower than `size` if it is outside of the windows
+        static constexpr std::size_t position(const type value) noexcept {
+            if (Windows::count == 1) {
+                // values below the window wrap around to large offsets; the offset is only narrowed after
+                // the range check, since std::size_t may be narrower than the underlying type
+                const std::uintmax_t offset =
+                    static_cast<std::uintmax_t>(value) - static_cast<std::uintmax_t>(Windows::mins[0]);
+                return offset < size ? static_cast<std::size_t>(offset) : size;
+            }
+            for (std::size_t w = 0; w < Windows::count; ++w) {
+                if (value >= Windows::mins[w] && value <= Windows::maxs[w]) {
+                    const std::uintmax_t offset =
+                        static_cast<std::uintmax_t>(value) - static_cast<std::uintmax_t>(Windows::mins[w]);
+                    return starts[w] + static_cast<std::size_t>(offset);
+                }
+            }
+            return size;
+        }
+
+        // Compilers handle huge packs poorly (gcc is quadratic in the pack length), so the probes are
+        // expanded in fixed-size blocks
+        static constexpr std::size_t BlockSize = 256;
+
+        static constexpr std::size_t blockSize(const std::size_t block) noexcept {
+            return std::min(BlockSize, size - block * BlockSize);
+        }
+
+        template <std::size_t TBlock, std::size_t... I>
+        static constexpr int probeBlock(Table<bool, size>& valid, std::index_sequence<I...>) noexcept {
+            const bool probed[] = {
+                validateEnum<TEnum, static_cast<TEnum>(valueAt(TBlock * BlockSize + I))>()...
+            };
+            for (std::size_t i = 0; i < sizeof...(I); ++i) {
+                valid[TBlock * BlockSize + i] = probed[i];
+            }
+            return 0;
+        }
+
+        template <std::size_t... TBlock>
+        static constexpr Table<bool, size> probe(std::index_sequence<TBlock...>) noexcept {
+            Table<bool, size> valid{};
+            const int blocks[] = {
+                probeBlock<TBlock>(valid, std::make_index_sequence<blockSize(TBlock)>{})...
+            };
+            static_cast<void>(blocks);
+            return valid;
+        }
+
+        static constexpr Table<bool, size> valid =
+            probe(std::make_index_sequence<(size + BlockSize - 1) / BlockSize>{});
+
+        static constexpr std::size_t getFirst() noexcept {
+            std::size_t i = 0;
+            while (i < size && !valid[i]) {
+                ++i;
+            }
+            return i;
+        }
+
+        static constexpr std::size_t getLast() noexcept {
+            std::size_t i = size;
+            while (i > 0 && !valid[i - 1]) {
+                --i;
+            }
+            return i;
+        }
+
+        static constexpr std::size_t getCount() noexcept {
+            std::size_t count = 0;
+            for (std::size_t i = 0; i < size; ++i) {
+                count += valid[i] ? 1 : 0;
+            }
+            return count;
+        }
 
-    template <typename T, short TIndexStop>
-    struct EnumMaxImpl<T, TIndexStop, TIndexStop, true> {
-        static constexpr short value = TIndexStop;
+        static constexpr std::size_t first = getFirst(); ///< index of the lowest valid value
+        static constexpr std::size_t last = getLast();   ///< index one past the highest valid value
+        static constexpr std::size_t count = getCount();
     };
 
+    template <typename TEnum>
+    constexpr Table<std::size_t, EnumWindowList<TEnum>::count + 1> EnumScan<TEnum>::starts;
+
+    /// The lowest valid value, or EnumLimits::max() if there is none
     template <typename T>
-    struct EnumMax {
-        static constexpr auto value =
-            static_cast<EnumType<T>>(EnumMaxImpl<T,
-                                                 EnumLimits<T>::min(), // stop at min
-                                                 EnumLimits<T>::max(), // start at max
-                                                 EnumValidIndex<T, EnumLimits<T>::max()>::value>::value);
+    struct EnumMin {
+        static constexpr EnumType<T> value =
+            EnumScan<T>::count > 0 ? EnumScan<T>::valueAt(EnumScan<T>::first) : EnumLimits<T>::max();
     };
 
-    template <typename T, std::size_t TIndex>
-    struct EnumValue {
-        using type = typename std::underlying_type<T>::type;
-        static constexpr type value = static_cast<type>(TIndex) + EnumMin<T>::value;
+    /// The highest valid value, or EnumLimits::min() if there is none
+    template <typename T>
+    struct EnumMax {
+        static constexpr EnumType<T> value =
+            EnumScan<T>::count > 0 ? EnumScan<T>::valueAt(EnumScan<T>::last - 1) : EnumLimits<T>::min();
     };
 
+    /// Number of values between EnumMin and EnumMax (inclusive), or 0 if there are no valid values
     template <typename T>
     struct EnumRange {
-        static constexpr std::size_t range() noexcept {
-            return static_cast<std::size_t>(EnumMax<T>::value - EnumMin<T>::value + 1);
-        }
-        static constexpr std::size_t value =
-            range() <= (ENUM_TRAITS_MAX_ENUM_VALUE - ENUM_TRAITS_MIN_ENUM_VALUE + 1) ? range() : 0ULL;
-    };
-
-    template <typename T, T... TArgs>
-    struct Accumulate {
-        static constexpr std::size_t accumulate() noexcept { return 0; }
-
-        template <typename... TRest>
-        static constexpr std::size_t accumulate(T element, TRest... rest) noexcept {
-            return element + accumulate(rest...);
-        }
-
-        static constexpr std::size_t value = accumulate(TArgs...);
+        static constexpr std::size_t value = EnumScan<T>::last - EnumScan<T>::first;
     };
 
     template <typename TEnum>
     struct EnumCount {
-        template <std::size_t... I>
-        static constexpr std::size_t count(std::index_sequence<I...>) noexcept {
-            return Accumulate<bool, EnumValidIndex<TEnum, EnumValue<TEnum, I>::value>::value...>::value;
-        }
-
-        static constexpr std::size_t value = count(std::make_index_sequence<EnumRange<TEnum>::value>{});
+        static constexpr std::size_t value = EnumScan<TEnum>::count;
     };
 
+    /// Validity of every value between EnumMin and EnumMax
     template <typename TEnum>
     struct EnumValidFlags {
-        template <std::size_t... I>
-        static constexpr auto getValidIndices(std::index_sequence<I...>) noexcept {
-            return std::integer_sequence<bool, EnumValidIndex<TEnum, EnumValue<TEnum, I>::value>::value...>{};
-        }
-
-        template <bool... I>
-        static constexpr std::array<bool, sizeof...(I)> toArray(std::integer_sequence<bool, I...>) noexcept {
-            return { (static_cast<bool>(I))... };
+        static constexpr bool get(const std::size_t i) noexcept {
+            return EnumScan<TEnum>::valid[EnumScan<TEnum>::first + i];
         }
-
-        static constexpr auto pack = getValidIndices(std::make_index_sequence<EnumRange<TEnum>::value>{});
-
-        static constexpr std::array<bool, EnumRange<TEnum>::value> value = toArray(pack);
     };
 
     template <typename TEnum>
@@ -334,25 +817,20 @@ namespace detail {
 
         template <std::size_t... I>
         static constexpr auto getValues(std::index_sequence<I...>) noexcept {
-            constexpr auto validFlags = EnumValidFlags<TEnum>::value;
-            TEnum values[size] = {};
-            for (std::size_t i = 0, k = 0; i < validFlags.size(); ++i) {
-                if (validFlags[i]) {
-                    values[k++] = static_cast<TEnum>(
-                        static_cast<typename std::underlying_type<TEnum>::type>(i) + EnumMin<TEnum>::value);
+            TEnum values[size > 0 ? size : 1] = {};
+            for (std::size_t i = EnumScan<TEnum>::first, k = 0; i < EnumScan<TEnum>::last; ++i) {
+                if (EnumScan<TEnum>::valid[i]) {
+                    values[k++] = static_cast<TEnum>(EnumScan<TEnum>::valueAt(i));
                 }
             }
             return toArray(values, std::make_index_sequence<size>{});
         }
 
-        static constexpr auto value = getValues(std::make_index_sequence<size>{});
+        static constexpr std::array<TEnum, size> value = getValues(std::make_index_sequence<size>{});
     };
 
-    template <typename T, std::size_t TIndex>
-    struct EnumValueFromIndex {
-        using type = typename std::underlying_type<T>::type;
-        static constexpr type value = static_cast<type>(EnumValues<T>::value[TIndex]);
-    };
+    template <typename TEnum>
+    constexpr std::array<TEnum, EnumValues<TEnum>::size> EnumValues<TEnum>::value;
 
     template <typename T, T TValue>
     constexpr auto getNameOfValidEnum() noexcept {
@@ -429,20 +907,842 @@ namespace detail {
         return getNameOfInvalidEnum<T, TValue>();
     }
 
-    template <typename TEnum, std::size_t... I>
-    constexpr auto getNamesImpl(std::index_sequence<I...>) noexcept {
-        return std::array<StaticString, sizeof...(I)>{
-            getName<TEnum, static_cast<TEnum>(EnumValueFromIndex<TEnum, I>::value)>()...
-        };
-    }
-
-    template <typename TEnum>
-    constexpr auto getNames() noexcept {
-        return getNamesImpl<TEnum>(std::make_index_sequence<EnumCount<TEnum>::value>{});
-    }
+#if ENUM_TRAITS_HAS_CPP17
+    /// Name of a valid enum value as a view into the signature, so no per-name character array has to be
+    /// built. The view is only read while the name pool is built.
+    template <typename T, T TValue>
+    ENUM_TRAITS_CONSTEVAL StringView getNameView() noexcept {
+#if defined(__clang__) || defined(__GNUC__) || defined(__GNUG__)
+        constexpr std::string_view signature(__PRETTY_FUNCTION__, sizeof(__PRETTY_FUNCTION__) - 1);
+        constexpr std::size_t end = signature.size() - 1;
+#elif defined(_MSC_VER)
+        constexpr std::string_view signature(__FUNCSIG__, sizeof(__FUNCSIG__) - 1);
+        constexpr std::size_t end = signature.size() - 16;
+#else
+#error "Unknown compiler - not supported"
+#endif
+        constexpr std::size_t colonPos = signature.rfind(':', end);
+        static_assert(colonPos != std::string_view::npos, "Unexpected signature output");
+        static_assert(end - colonPos - 1 < ENUM_TRAITS_MAX_NAME_LENGTH,
+                      "The default maximum length of enum name is 64 characters. To increase the length, "
+                      "define ENUM_TRAITS_MAX_NAME_LENGTH to a higher value");
+        return StringView(signature.data() + colonPos + 1, end - colonPos - 1);
+    }
+
+    template <typename TEnum, std::size_t... I>
+    ENUM_TRAITS_CONSTEVAL auto getNamesImpl(std::index_sequence<I...>) noexcept {
+        return std::array<StringView, sizeof...(I)>{
+            { getNameView<TEnum, EnumValues<TEnum>::value[I]>()... }
+        };
+    }
+#else
+    template <typename TEnum, std::size_t... I>
+    constexpr auto getNamesImpl(std::index_sequence<I...>) noexcept {
+        return std::array<StaticString, sizeof...(I)>{ getName<TEnum, EnumValues<TEnum>::value[I]>()... };
+    }
+#endif
+
+    template <typename TEnum>
+    ENUM_TRAITS_CONSTEVAL auto getNames() noexcept {
+        return getNamesImpl<TEnum>(std::make_index_sequence<EnumCount<TEnum>::value>{});
+    }
+
+    template <typename T, std::size_t TSize>
+    constexpr std::size_t length(const SizedString<T, TSize>& str) noexcept {
+        std::size_t size = 0;
+        while (str[size] != 0) {
+            ++size;
+        }
+        return size;
+    }
+
+    constexpr std::size_t length(const StringView str) noexcept { return str.size(); }
+
+    /// Names packed back to back (NUL-terminated) into a single character pool with an offset/length
+    /// table. Entry `size` is an empty name used for values which are not valid.
+    /// TSource provides `size` and `parsed`, an array of the names (anything with length() and operator[],
+    /// like StaticString or, in C++17, StringView into the signatures), which is only used
+    /// while building the tables - it is never odr-used, so it does not end up in the binary.
+    template <typename TSource>
+    struct NamePool {
+        static constexpr std::size_t size = TSource::size;
+
+        static constexpr std::size_t getPoolSize() noexcept {
+            std::size_t poolSize = 1; // the empty name
+            for (std::size_t i = 0; i < size; ++i) {
+                poolSize += length(TSource::parsed[i]) + 1;
+            }
+            return poolSize;
+        }
+
+        static constexpr std::size_t poolSize = getPoolSize();
+
+        using OffsetType = SmallestUnsigned<poolSize>;
+        using LengthType = SmallestUnsigned<ENUM_TRAITS_MAX_NAME_LENGTH>;
+
+        static constexpr Table<char, poolSize> getPool() noexcept {
+            Table<char, poolSize> pool{};
+            for (std::size_t i = 0, k = 0; i < size; ++i, ++k) {
+                for (std::size_t c = 0, n = length(TSource::parsed[i]); c < n; ++c) {
+                    pool[k++] = TSource::parsed[i][c];
+                }
+            }
+            return pool;
+        }
+
+        static constexpr Table<OffsetType, size + 1> getOffsets() noexcept {
+            Table<OffsetType, size + 1> offsets{};
+            std::size_t offset = 0;
+            for (std::size_t i = 0; i < size; ++i) {
+                offsets[i] = static_cast<OffsetType>(offset);
+                offset += length(TSource::parsed[i]) + 1;
+            }
+            offsets[size] = static_cast<OffsetType>(offset);
+            return offsets;
+        }
+
+        static constexpr Table<LengthType, size + 1> getLengths() noexcept {
+            Table<LengthType, size + 1> lengths{};
+            for (std::size_t i = 0; i < size; ++i) {
+                lengths[i] = static_cast<LengthType>(length(TSource::parsed[i]));
+            }
+            return lengths;
+        }
+
+        static constexpr Table<char, poolSize> pool = getPool();
+        static constexpr Table<OffsetType, size + 1> offsets = getOffsets();
+        static constexpr Table<LengthType, size + 1> lengths = getLengths();
+
+        static constexpr StringView get(const std::size_t i) noexcept {
+            return StringView(pool.data + offsets[i], lengths[i]);
+        }
+    };
+
+    template <typename TSource>
+    constexpr Table<char, NamePool<TSource>::poolSize> NamePool<TSource>::pool;
+
+    template <typename TSource>
+    constexpr Table<typename NamePool<TSource>::OffsetType, NamePool<TSource>::size + 1>
+        NamePool<TSource>::offsets;
+
+    template <typename TSource>
+    constexpr Table<typename NamePool<TSource>::LengthType, NamePool<TSource>::size + 1>
+        NamePool<TSource>::lengths;
+
+    template <typename TEnum>
+    struct EnumParsedNames {
+        static constexpr std::size_t size = EnumCount<TEnum>::value;
+        static constexpr auto parsed = getNames<TEnum>();
+    };
+
+    /// Names of all valid values of TEnum in the order of EnumValues
+    template <typename TEnum>
+    using EnumNames = NamePool<EnumParsedNames<TEnum>>;
+
+    template <typename TEnum, std::size_t... I>
+    constexpr std::array<StringView, sizeof...(I)> getNameViews(std::index_sequence<I...>) noexcept {
+        return { { EnumNames<TEnum>::get(I)... } };
+    }
+
+    /// Dense table mapping `value - EnumMin` to the position of the value in EnumValues (or to
+    /// EnumCount when there is no such value)
+    template <typename TEnum>
+    struct EnumDenseIndex {
+        static constexpr std::size_t range = EnumRange<TEnum>::value;
+        static constexpr std::size_t size = EnumCount<TEnum>::value;
+        using type = SmallestUnsigned<size>;
+
+        static constexpr Table<type, range> getIndices() noexcept {
+            Table<type, range> indices{};
+            for (std::size_t i = 0, k = 0; i < range; ++i) {
+                indices[i] = static_cast<type>(EnumValidFlags<TEnum>::get(i) ? k++ : size);
+            }
+            return indices;
+        }
+
+        static constexpr Table<type, range> value = getIndices();
+    };
+
+    template <typename TEnum>
+    constexpr Table<typename EnumDenseIndex<TEnum>::type, EnumDenseIndex<TEnum>::range>
+        EnumDenseIndex<TEnum>::value;
+
+    /// Scan position of the value relative to EnumMin; values below EnumMin wrap around to large slots,
+    /// values outside of the scanned windows get a slot not lower than EnumRange. This also holds for
+    /// 64-bit values on targets with a 32-bit std::size_t, see EnumScan::position().
+    template <typename TEnum>
+    constexpr std::size_t getSlot(const typename std::underlying_type<TEnum>::type value) noexcept {
+        // positions outside of the windows are not lower than `size`, so they stay out of EnumRange too
+        return EnumScan<TEnum>::position(value) - EnumScan<TEnum>::first;
+    }
+
+    template <typename TEnum>
+    constexpr std::size_t getSlot(const TEnum value) noexcept {
+        return getSlot<TEnum>(static_cast<typename std::underlying_type<TEnum>::type>(value));
+    }
+
+    /// Validity of every value between EnumMin and EnumMax packed into 64-bit words
+    template <typename TEnum>
+    struct EnumValidBits {
+        static constexpr std::size_t range = EnumRange<TEnum>::value;
+        static constexpr std::size_t size = (range + 63) / 64;
+
+        static constexpr Table<std::uint64_t, size> getBits() noexcept {
+            Table<std::uint64_t, size> bits{};
+            for (std::size_t i = 0; i < range; ++i) {
+                if (EnumValidFlags<TEnum>::get(i)) {
+                    bits[i / 64] |= static_cast<std::uint64_t>(1) << (i % 64);
+                }
+            }
+            return bits;
+        }
+
+        static constexpr Table<std::uint64_t, size> value = getBits();
+
+        static constexpr bool test(const std::size_t slot) noexcept {
+            return slot < range && ((value[slot / 64] >> (slot % 64)) & 1) != 0;
+        }
+    };
+
+    template <typename TEnum>
+    constexpr Table<std::uint64_t, EnumValidBits<TEnum>::size> EnumValidBits<TEnum>::value;
+
+    /// Whether the valid values of TEnum are exactly EnumMin..EnumMax, in which case the position of a
+    /// value is its offset from EnumMin and none of the value tables is needed
+    template <typename TEnum>
+    struct EnumContiguous {
+        static constexpr bool value =
+            EnumCount<TEnum>::value != 0 && static_cast<std::uintmax_t>(EnumMax<TEnum>::value) -
+                                                    static_cast<std::uintmax_t>(EnumMin<TEnum>::value) + 1 ==
+                                                EnumCount<TEnum>::value;
+    };
+
+    template <typename TEnum>
+    using IsContiguous = std::integral_constant<bool, EnumContiguous<TEnum>::value>;
+
+    /// Position of `value` in EnumValues, or EnumCount if it is not valid
+    template <typename TEnum>
+    constexpr std::size_t getIndex(const EnumType<TEnum> value, std::true_type) noexcept {
+        const std::uintmax_t offset =
+            static_cast<std::uintmax_t>(value) - static_cast<std::uintmax_t>(EnumMin<TEnum>::value);
+        return offset < EnumCount<TEnum>::value ? static_cast<std::size_t>(offset) : EnumCount<TEnum>::value;
+    }
+
+    template <typename TEnum>
+    constexpr std::size_t getIndex(const EnumType<TEnum> value, std::false_type) noexcept {
+        const std::size_t slot = getSlot<TEnum>(value);
+        return slot < EnumRange<TEnum>::value ? EnumDenseIndex<TEnum>::value[slot] : EnumCount<TEnum>::value;
+    }
+
+    template <typename TEnum>
+    constexpr bool isValidValue(const EnumType<TEnum> value, std::true_type contiguous) noexcept {
+        return getIndex<TEnum>(value, contiguous) < EnumCount<TEnum>::value;
+    }
+
+    template <typename TEnum>
+    constexpr bool isValidValue(const EnumType<TEnum> value, std::false_type) noexcept {
+        return EnumValidBits<TEnum>::test(getSlot<TEnum>(value));
+    }
+
+    /// The value at position `index` (lower than EnumCount) in EnumValues
+    template <typename TEnum>
+    constexpr TEnum getValue(const std::size_t index, std::true_type) noexcept {
+        return static_cast<TEnum>(
+            static_cast<EnumType<TEnum>>(static_cast<std::uintmax_t>(EnumMin<TEnum>::value) + index));
+    }
+
+    template <typename TEnum>
+    constexpr TEnum getValue(const std::size_t index, std::false_type) noexcept {
+        return EnumValues<TEnum>::value[index];
+    }
+
+    template <typename TEnum>
+    constexpr ContiguousValues<TEnum> getValueRange(std::true_type) noexcept {
+        return ContiguousValues<TEnum>(EnumMin<TEnum>::value, EnumCount<TEnum>::value);
+    }
+
+    template <typename TEnum>
+    constexpr std::array<TEnum, EnumCount<TEnum>::value> getValueRange(std::false_type) noexcept {
+        constexpr auto values = EnumValues<TEnum>::value;
+        return values;
+    }
+
+    /// The aliases of TEnum (see EnumAliasTraits) and the positions of their values in EnumValues, followed
+    /// by EnumCount for the lookups which did not find any key
+    template <typename TEnum, typename = void>
+    struct EnumAliasList {
+        static constexpr std::size_t size = 0;
+    };
+
+    template <typename TEnum>
+    struct EnumAliasList<TEnum, VoidType<decltype(EnumAliasTraits<TEnum>::aliases)>> {
+        using Aliases = EnumAliasTraits<TEnum>;
+        using IndexType = SmallestUnsigned<EnumCount<TEnum>::value>;
+
+        static constexpr std::size_t size = std::extent<decltype(Aliases::aliases)>::value;
+
+        static constexpr Table<StringView, size> getNames() noexcept {
+            Table<StringView, size> names{};
+            for (std::size_t i = 0; i < size; ++i) {
+                names[i] = StringView(Aliases::aliases[i].name, cstrlen(Aliases::aliases[i].name));
+            }
+            return names;
+        }
+
+        static constexpr Table<IndexType, size + 1> getIndexes() noexcept {
+            Table<IndexType, size + 1> indexes{};
+            for (std::size_t i = 0; i < size; ++i) {
+                indexes[i] = static_cast<IndexType>(getIndex<TEnum>(
+                    static_cast<EnumType<TEnum>>(Aliases::aliases[i].value), IsContiguous<TEnum>{}));
+            }
+            indexes[size] = static_cast<IndexType>(EnumCount<TEnum>::value);
+            return indexes;
+        }
+
+        static constexpr Table<StringView, size> names = getNames();
+        static constexpr Table<IndexType, size + 1> indexes = getIndexes();
+
+        static constexpr bool allValid() noexcept {
+            for (std::size_t i = 0; i < size; ++i) {
+                if (indexes[i] == EnumCount<TEnum>::value) {
+                    return false;
+                }
+            }
+            return true;
+        }
+
+        static_assert(allValid(), "EnumAliasTraits<T> must only name valid values of T");
+    };
+
+    template <typename TEnum>
+    constexpr Table<StringView,
+                    EnumAliasList<TEnum, VoidType<decltype(EnumAliasTraits<TEnum>::aliases)>>::size>
+        EnumAliasList<TEnum, VoidType<decltype(EnumAliasTraits<TEnum>::aliases)>>::names;
+
+    template <typename TEnum>
+    constexpr Table<
+        typename EnumAliasList<TEnum, VoidType<decltype(EnumAliasTraits<TEnum>::aliases)>>::IndexType,
+        EnumAliasList<TEnum, VoidType<decltype(EnumAliasTraits<TEnum>::aliases)>>::size + 1>
+        EnumAliasList<TEnum, VoidType<decltype(EnumAliasTraits<TEnum>::aliases)>>::indexes;
+
+    template <typename TEnum>
+    using HasAliases = std::integral_constant<bool, EnumAliasList<TEnum>::size != 0>;
+
+    /// The names of TEnum followed by its aliases
+    template <typename TEnum>
+    struct EnumNamesAndAliases {
+        static constexpr std::size_t size = EnumCount<TEnum>::value + EnumAliasList<TEnum>::size;
+
+        static constexpr StringView get(const std::size_t i) noexcept {
+            return i < EnumCount<TEnum>::value ? EnumNames<TEnum>::get(i)
+                                               : EnumAliasList<TEnum>::names[i - EnumCount<TEnum>::value];
+        }
+    };
+
+    /// Keys of the exact lookups: the names, followed by the aliases if TEnum has any
+    template <typename TEnum>
+    using EnumKeys = typename std::
+        conditional<HasAliases<TEnum>::value, EnumNamesAndAliases<TEnum>, EnumNames<TEnum>>::type;
+
+    /// Position in EnumValues of the value of key `key` of EnumKeys, or EnumCount if `key` is
+    /// EnumKeys::size (a miss)
+    template <typename TEnum>
+    constexpr std::size_t getKeyIndex(const std::size_t key, std::false_type) noexcept {
+        return key;
+    }
+
+    template <typename TEnum>
+    constexpr std::size_t getKeyIndex(const std::size_t key, std::true_type) noexcept {
+        constexpr std::size_t count = EnumCount<TEnum>::value;
+        return key < count ? key : EnumAliasList<TEnum>::indexes[key - count];
+    }
+
+    static constexpr std::uint64_t HashOffset = 0xcbf29ce484222325ULL;
+
+    /// One step of FNV-1a
+    constexpr std::uint64_t hashStep(const std::uint64_t hash, const char c) noexcept {
+        return (hash ^ static_cast<unsigned char>(c)) * 0x100000001b3ULL;
+    }
+
+    /// Final avalanche so that both halves of the hash are usable
+    constexpr std::uint64_t hashFinish(std::uint64_t hash) noexcept {
+        hash ^= hash >> 33;
+        hash *= 0xff51afd7ed558ccdULL;
+        hash ^= hash >> 33;
+        hash *= 0xc4ceb9fe1a85ec53ULL;
+        return hash ^ (hash >> 33);
+    }
+
+    constexpr std::uint64_t hashString(const char* str, const std::size_t size) noexcept {
+        std::uint64_t hash = HashOffset;
+        for (std::size_t i = 0; i < size; ++i) {
+            hash = hashStep(hash, str[i]);
+        }
+        return hashFinish(hash);
+    }
+
+    /// Maps a 32-bit value uniformly onto [0, range) without a division
+    constexpr std::size_t reduce(const std::uint32_t value, const std::size_t range) noexcept {
+        return static_cast<std::size_t>((static_cast<std::uint64_t>(value) * range) >> 32);
+    }
+
+    constexpr bool equal(const char* a, const char* b, const std::size_t size) noexcept {
+        for (std::size_t i = 0; i < size; ++i) {
+            if (a[i] != b[i]) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    /// Hash of the whole string, see hashString()
+    struct StringHash {
+        static constexpr std::uint64_t hash(const char* str, const std::size_t size) noexcept {
+            return hashString(str, size);
+        }
+    };
+
+    /// Hash of the length and of the first, middle and last characters only, so that it costs the same
+    /// for strings of any length. Only usable for keys which all differ in one of these, see
+    /// hasDistinctSamples().
+    struct SampledHash {
+        static constexpr std::uint64_t hash(const char* str, const std::size_t size) noexcept {
+            if (size == 0) {
+                return hashFinish(0);
+            }
+            const auto first = static_cast<std::uint64_t>(static_cast<unsigned char>(str[0]));
+            const auto middle = static_cast<std::uint64_t>(static_cast<unsigned char>(str[size / 2]));
+            const auto last = static_cast<std::uint64_t>(static_cast<unsigned char>(str[size - 1]));
+            return hashFinish(static_cast<std::uint32_t>(size) | first << 32 | middle << 40 | last << 48);
+        }
+    };
+
+    /// Whether SampledHash tells all the keys apart (hashFinish() is a bijection, so equal hashes mean
+    /// equal samples)
+    template <typename TKeys>
+    constexpr bool hasDistinctSamples() noexcept {
+        Table<std::uint64_t, TKeys::size> hashes{};
+        for (std::size_t i = 0; i < TKeys::size; ++i) {
+            const StringView key = TKeys::get(i);
+            hashes[i] = SampledHash::hash(key.data(), key.size());
+            for (std::size_t j = 0; j < i; ++j) {
+                if (hashes[j] == hashes[i]) {
+                    return false;
+                }
+            }
+        }
+        return true;
+    }
+
+    /// Minimal perfect hash over a set of distinct keys, built at compile time with the "hash and
+    /// displace" scheme: the key hash picks a bucket and the bucket's pilot displaces the key into its own
+    /// slot. A lookup is one string hash, two table loads, a length check and one comparison.
+    /// TKeys provides `size` and `get(i)` returning a StringView of the i-th key. THash must not hash any
+    /// two of the keys to the same value.
+    template <typename TKeys, typename THash = StringHash>
+    struct PerfectHash {
+        static constexpr std::size_t size = TKeys::size;
+        static constexpr std::size_t bucketCount = size > 0 ? size : 1;
+        static constexpr std::uint32_t maxPilot = 0xFFFFFF;
+
+        static constexpr std::size_t bucket(const std::uint64_t hash) noexcept {
+            return reduce(static_cast<std::uint32_t>(hash >> 32), bucketCount);
+        }
+
+        static constexpr std::size_t position(const std::uint64_t hash, const std::uint32_t pilot) noexcept {
+            return reduce(static_cast<std::uint32_t>(hashFinish(hash ^ pilot)), size);
+        }
+
+        struct Result {
+            Table<std::uint32_t, bucketCount> pilots;
+            Table<std::size_t, size> slots;
+            std::uint32_t highestPilot;
+            bool ok;
+        };
+
+        static constexpr Result build() noexcept {
+            Result result{};
+            Table<std::uint64_t, size> hashes{};
+            Table<std::size_t, bucketCount + 1> bucketStart{};
+            for (std::size_t i = 0; i < size; ++i) {
+                const StringView key = TKeys::get(i);
+                hashes[i] = THash::hash(key.data(), key.size());
+                ++bucketStart[bucket(hashes[i]) + 1];
+            }
+
+            // counting sort of the keys by bucket
+            std::size_t largestBucket = 0;
+            for (std::size_t b = 0; b < bucketCount; ++b) {
+                largestBucket = std::max(largestBucket, bucketStart[b + 1]);
+                bucketStart[b + 1] += bucketStart[b];
+            }
+            Table<std::size_t, size> keys{};
+            Table<std::size_t, bucketCount> fill{};
+            for (std::size_t i = 0; i < size; ++i) {
+                const std::size_t b = bucket(hashes[i]);
+                keys[bucketStart[b] + fill[b]++] = i;
+            }
+
+            // place the largest buckets first while the table is still mostly empty
+            Table<bool, size> taken{};
+            Table<std::size_t, size> positions{};
+            for (std::size_t bucketSize = largestBucket; bucketSize > 0; --bucketSize) {
+                for (std::size_t b = 0; b < bucketCount; ++b) {
+                    if (bucketStart[b + 1] - bucketStart[b] != bucketSize) {
+                        continue;
+                    }
+                    bool placed = false;
+                    for (std::uint32_t pilot = 0; !placed && pilot <= maxPilot; ++pilot) {
+                        placed = true;
+                        for (std::size_t k = 0; placed && k < bucketSize; ++k) {
+                            positions[k] = position(hashes[keys[bucketStart[b] + k]], pilot);
+                            placed = !taken[positions[k]];
+                            for (std::size_t j = 0; placed && j < k; ++j) {
+                                placed = positions[j] != positions[k];
+                            }
+                        }
+                        if (placed) {
+                            for (std::size_t k = 0; k < bucketSize; ++k) {
+                                taken[positions[k]] = true;
+                                result.slots[positions[k]] = keys[bucketStart[b] + k];
+                            }
+                            result.pilots[b] = pilot;
+                            result.highestPilot = std::max(result.highestPilot, pilot);
+                        }
+                    }
+                    if (!placed) {
+                        return result;
+                    }
+                }
+            }
+            result.ok = true;
+            return result;
+        }
+
+        // Only used while building the tables below - never odr-used, so it does not end up in the binary
+        static constexpr Result built = build();
+        static_assert(built.ok, "Unable to build a perfect hash of the enum names (duplicate keys?)");
+
+        using PilotType = SmallestUnsigned<built.highestPilot>;
+        using IndexType = SmallestUnsigned<size>;
+
+        static constexpr Table<PilotType, bucketCount> getPilots() noexcept {
+            Table<PilotType, bucketCount> pilots{};
+            for (std::size_t b = 0; b < bucketCount; ++b) {
+                pilots[b] = static_cast<PilotType>(built.pilots[b]);
+            }
+            return pilots;
+        }
+
+        static constexpr Table<IndexType, size> getSlots() noexcept {
+            Table<IndexType, size> slots{};
+            for (std::size_t i = 0; i < size; ++i) {
+                slots[i] = static_cast<IndexType>(built.slots[i]);
+            }
+            return slots;
+        }
+
+        static constexpr Table<PilotType, bucketCount> pilots = getPilots();
+        static constexpr Table<IndexType, size> slots = getSlots();
+
+        /// Returns the index of the key equal to `str` or `size` if there is no such key.
+        /// `hash` must be THash::hash(str, strSize).
+        static constexpr std::size_t
+        find(const char* str, const std::size_t strSize, const std::uint64_t hash) noexcept {
+            if (size == 0) {
+                return size;
+            }
+            const std::size_t index = candidate(hash);
+            return matches(index, str, strSize) ? index : size;
+        }
+
+        /// The only key which may be equal to a string with the given hash (there must be some keys)
+        static constexpr std::size_t candidate(const std::uint64_t hash) noexcept {
+            return slots[position(hash, pilots[bucket(hash)])];
+        }
+
+        static constexpr bool
+        matches(const std::size_t index, const char* str, const std::size_t strSize) noexcept {
+            const StringView key = TKeys::get(index);
+            return key.size() == strSize && equal(key.data(), str, strSize);
+        }
+    };
+
+    template <typename TKeys, typename THash>
+    constexpr Table<typename PerfectHash<TKeys, THash>::PilotType, PerfectHash<TKeys, THash>::bucketCount>
+        PerfectHash<TKeys, THash>::pilots;
+
+    template <typename TKeys, typename THash>
+    constexpr Table<typename PerfectHash<TKeys, THash>::IndexType, PerfectHash<TKeys, THash>::size>
+        PerfectHash<TKeys, THash>::slots;
+
+    /// Cheap pre-check for lookups: rejects strings whose length or first character does not occur in
+    /// any of the keys without hashing them
+    template <typename TKeys>
+    struct KeyFilter {
+        static constexpr std::size_t getMaxLength() noexcept {
+            std::size_t maxLength = 0;
+            for (std::size_t i = 0; i < TKeys::size; ++i) {
+                maxLength = std::max(maxLength, TKeys::get(i).size());
+            }
+            return maxLength;
+        }
+
+        static constexpr std::size_t maxLength = getMaxLength();
+
+        static constexpr Table<std::uint64_t, maxLength / 64 + 1> getLengths() noexcept {
+            Table<std::uint64_t, maxLength / 64 + 1> lengths{};
+            for (std::size_t i = 0; i < TKeys::size; ++i) {
+                const std::size_t size = TKeys::get(i).size();
+                lengths[size / 64] |= static_cast<std::uint64_t>(1) << (size % 64);
+            }
+            return lengths;
+        }
+
+        static constexpr Table<std::uint64_t, 4> getFirstChars() noexcept {
+            Table<std::uint64_t, 4> firstChars{};
+            for (std::size_t i = 0; i < TKeys::size; ++i) {
+                const StringView key = TKeys::get(i);
+                if (!key.empty()) {
+                    const auto c = static_cast<unsigned char>(key[0]);
+                    firstChars[c / 64] |= static_cast<std::uint64_t>(1) << (c % 64);
+                }
+            }
+            return firstChars;
+        }
+
+        static constexpr Table<std::uint64_t, maxLength / 64 + 1> lengths = getLengths();
+        static constexpr Table<std::uint64_t, 4> firstChars = getFirstChars();
+
+        static constexpr bool mayContain(const char* str, const std::size_t size) noexcept {
+            const auto c = static_cast<unsigned char>(size > 0 ? str[0] : 0);
+            return size <= maxLength && ((lengths[size / 64] >> (size % 64)) & 1) != 0 &&
+                   (size == 0 || ((firstChars[c / 64] >> (c % 64)) & 1) != 0);
+        }
+    };
+
+    template <typename TKeys>
+    constexpr Table<std::uint64_t, KeyFilter<TKeys>::maxLength / 64 + 1> KeyFilter<TKeys>::lengths;
+
+    template <typename TKeys>
+    constexpr Table<std::uint64_t, 4> KeyFilter<TKeys>::firstChars;
+
+    /// The names and aliases of TEnum in lexicographic order (as unsigned chars), used for prefix queries:
+    /// the keys starting with a given prefix are always a contiguous run of this table
+    template <typename TEnum>
+    struct EnumSortedNames {
+        using Keys = EnumKeys<TEnum>;
+
+        static constexpr std::size_t size = Keys::size;
+        using IndexType = SmallestUnsigned<size>;
+
+        /// Character `k` of `name`, or -1 past its end so that shorter names sort first
+        static constexpr int charAt(const StringView name, const std::size_t k) noexcept {
+            return k < name.size() ? static_cast<unsigned char>(name[k]) : -1;
+        }
+
+        static constexpr bool less(const StringView lhs, const StringView rhs) noexcept {
+            for (std::size_t k = 0; k < lhs.size() || k < rhs.size(); ++k) {
+                if (charAt(lhs, k) != charAt(rhs, k)) {
+                    return charAt(lhs, k) < charAt(rhs, k);
+                }
+            }
+            return false;
+        }
+
+        static constexpr Table<IndexType, size> getOrder() noexcept {
+            Table<IndexType, size> order{};
+            for (std::size_t i = 0; i < size; ++i) {
+                std::size_t k = i;
+                for (; k > 0 && less(Keys::get(i), Keys::get(order[k - 1])); --k) {
+                    order[k] = order[k - 1];
+                }
+                order[k] = static_cast<IndexType>(i);
+            }
+            return order;
+        }
+
+        /// Position of every sorted name in EnumKeys
+        static constexpr Table<IndexType, size> order = getOrder();
+
+        static constexpr Table<TEnum, size> getValues() noexcept {
+            Table<TEnum, size> values{};
+            for (std::size_t i = 0; i < size; ++i) {
+                values[i] = EnumValues<TEnum>::value[getKeyIndex<TEnum>(order[i], HasAliases<TEnum>{})];
+            }
+            return values;
+        }
+
+        /// The values in the order of their names
+        static constexpr Table<TEnum, size> values = getValues();
+
+        static constexpr StringView get(const std::size_t i) noexcept {
+            return Keys::get(order[i]);
+        }
+
+        /// Narrows [begin, end), the names sharing their first `k` characters, to those whose character
+        /// `k` is `c` with two binary searches
+        static constexpr void
+        narrow(std::size_t& begin, std::size_t& end, const std::size_t k, const int c) noexcept {
+            std::size_t low = begin;
+            std::size_t high = end;
+            while (low < high) {
+                const std::size_t middle = low + (high - low) / 2;
+                if (charAt(get(middle), k) < c) {
+                    low = middle + 1;
+                } else {
+                    high = middle;
+                }
+            }
+            begin = low;
+            high = end;
+            while (low < high) {
+                const std::size_t middle = low + (high - low) / 2;
+                if (charAt(get(middle), k) <= c) {
+                    low = middle + 1;
+                } else {
+                    high = middle;
+                }
+            }
+            end = low;
+        }
+    };
+
+    template <typename TEnum>
+    constexpr Table<typename EnumSortedNames<TEnum>::IndexType, EnumSortedNames<TEnum>::size>
+        EnumSortedNames<TEnum>::order;
+
+    template <typename TEnum>
+    constexpr Table<TEnum, EnumSortedNames<TEnum>::size> EnumSortedNames<TEnum>::values;
+
+    template <unsigned TOptions>
+    constexpr char normalize(const char c) noexcept {
+        return (TOptions & IgnoreCase) != 0 && c >= 'A' && c <= 'Z' ? static_cast<char>(c - 'A' + 'a') : c;
+    }
+
+    template <unsigned TOptions>
+    constexpr bool isSkipped(const char c) noexcept {
+        return (TOptions & IgnoreUnderscores) != 0 && c == '_';
+    }
+
+    /// Position in `str` right after `prefix` (both compared with TOptions), or 0 if `str` does not
+    /// start with `prefix`
+    template <unsigned TOptions>
+    constexpr std::size_t
+    skipPrefix(const char* str, const std::size_t size, const StringView prefix) noexcept {
+        std::size_t i = 0;
+        for (std::size_t k = 0; k < prefix.size(); ++k) {
+            if (isSkipped<TOptions>(prefix[k])) {
+                continue;
+            }
+            while (i < size && isSkipped<TOptions>(str[i])) {
+                ++i;
+            }
+            if (i == size || normalize<TOptions>(str[i]) != normalize<TOptions>(prefix[k])) {
+                return 0;
+            }
+            ++i;
+        }
+        return i;
+    }
+
+    using NameBuffer = Table<char, ENUM_TRAITS_MAX_NAME_LENGTH>;
+
+    template <std::size_t TSize>
+    constexpr std::size_t length(const Table<char, TSize>& str) noexcept {
+        std::size_t size = 0;
+        while (str[size] != 0) {
+            ++size;
+        }
+        return size;
+    }
+
+    /// Names of TEnum normalized with TOptions, the source of a NamePool
+    template <typename TEnum, unsigned TOptions>
+    struct EnumNormalizedNames {
+        static constexpr std::size_t size = EnumCount<TEnum>::value;
+
+        static constexpr NameBuffer getName(const std::size_t i) noexcept {
+            NameBuffer name{};
+            const StringView original = EnumNames<TEnum>::get(i);
+            for (std::size_t c = 0, k = 0; c < original.size(); ++c) {
+                if (!isSkipped<TOptions>(original[c])) {
+                    name[k++] = normalize<TOptions>(original[c]);
+                }
+            }
+            return name;
+        }
+
+        /// Whether the normalized character `k` (not the first one) of name `i` starts a word of the
+        /// original name: it follows an underscore or it is an uppercase letter after a lowercase one
+        static constexpr bool isWordStart(const std::size_t i, const std::size_t k) noexcept {
+            const StringView original = EnumNames<TEnum>::get(i);
+            std::size_t c = 0;
+            for (std::size_t kept = 0; c < original.size(); ++c) {
+                if (!isSkipped<TOptions>(original[c]) && kept++ == k) {
+                    break;
+                }
+            }
+            if (c == 0 || c >= original.size()) {
+                return false;
+            }
+            const char previous = original[c - 1];
+            const char current = original[c];
+            const bool afterLower =
+                (previous >= 'a' && previous <= 'z') || (previous >= '0' && previous <= '9');
+            return previous == '_' || (afterLower && current >= 'A' && current <= 'Z');
+        }
+
+        /// Length of the prefix shared by all the normalized names. It leaves at least one character of
+        /// each name and ends at a word boundary of all of them, so {Apples, Apricots} keep their "Ap".
+        static constexpr std::size_t getPrefixLength() noexcept {
+            if ((TOptions & StripCommonPrefix) == 0 || size < 2) {
+                return 0;
+            }
+            const NameBuffer first = getName(0);
+            std::size_t prefix = length(first);
+            for (std::size_t i = 0; i < size; ++i) {
+                const NameBuffer name = getName(i);
+                std::size_t common = 0;
+                while (common < prefix && name[common] == first[common]) {
+                    ++common;
+                }
+                prefix = std::min(common, length(name) > 0 ? length(name) - 1 : 0);
+            }
+            for (; prefix > 0; --prefix) {
+                bool boundary = true;
+                for (std::size_t i = 0; boundary && i < size; ++i) {
+                    boundary = isWordStart(i, prefix);
+                }
+                if (boundary) {
+                    break;
+                }
+            }
+            return prefix;
+        }
+
+        static constexpr std::size_t prefixLength = getPrefixLength();
+
+        static constexpr Table<NameBuffer, size> getParsed() noexcept {
+            Table<NameBuffer, size> parsed{};
+            for (std::size_t i = 0; i < size; ++i) {
+                const NameBuffer name = getName(i);
+                for (std::size_t c = prefixLength; name[c] != 0; ++c) {
+                    parsed[i][c - prefixLength] = name[c];
+                }
+            }
+            return parsed;
+        }
+
+        static constexpr Table<NameBuffer, size> parsed = getParsed();
+    };
 
 } // namespace detail
 
+/// Runtime aliases of TEnum, defined in enum-traits/enum-aliases.hpp
+template <typename TEnum>
+class EnumAliasRegistry;
+
 template <typename T>
 struct EnumTraits {
     using UnderlyingType = typename std::underlying_type<T>::type;
@@ -454,45 +1754,348 @@ struct EnumTraits {
 
     static constexpr UnderlyingType max() noexcept { return detail::EnumMax<T>::value; }
 
+    /// Number of valid values
+    static constexpr std::size_t count() noexcept { return detail::EnumCount<T>::value; }
+
+    /// Whether the valid values are exactly min()..max(). Then values() is a ContiguousValues range
+    /// computed from min(), and index(), isValid() and name() only subtract min() and compare.
+    static constexpr bool isContiguous() noexcept { return detail::EnumContiguous<T>::value; }
+
+    /// All valid values in ascending order: a std::array, or a ContiguousValues range if isContiguous()
     template <typename...,
               std::size_t TSize = detail::EnumRange<T>::value,
               typename std::enable_if<TSize != 0, bool>::type = true>
     static constexpr auto values() noexcept {
-        constexpr auto values = detail::EnumValues<T>::value;
-        return values;
+        return detail::getValueRange<T>(detail::IsContiguous<T>{});
+    }
+
+    template <typename...,
+              std::size_t TSize = detail::EnumRange<T>::value,
+              typename std::enable_if<TSize != 0, bool>::type = true>
+    static constexpr std::array<StringView, detail::EnumCount<T>::value> names() noexcept {
+        return detail::getNameViews<T>(std::make_index_sequence<detail::EnumCount<T>::value>{});
+    }
+
+    template <typename...,
+              std::size_t TSize = detail::EnumRange<T>::value,
+              typename std::enable_if<TSize != 0, bool>::type = true>
+    static constexpr StringView name(const T value) noexcept {
+        const std::size_t i = index(value);
+#if ENUM_TRAITS_INSTRUMENTATION
+        if (!detail::isConstantEvaluated()) {
+            detail::EnumStats<T>::record(i < count() ? detail::EnumEvent::Hit : detail::EnumEvent::Invalid);
+        }
+#endif
+        return detail::EnumNames<T>::get(i);
+    }
+
+    /// Copies the name of `value` (empty for invalid values) into `out` without a terminating NUL.
+    /// Returns the length of the name; when it is greater than `capacity`, only the first `capacity`
+    /// characters have been written.
+    template <typename...,
+              std::size_t TSize = detail::EnumRange<T>::value,
+              typename std::enable_if<TSize != 0, bool>::type = true>
+    static std::size_t writeName(const T value, char* out, const std::size_t capacity) noexcept {
+        const StringView name = EnumTraits::name(value);
+        if (capacity != 0) {
+            std::copy_n(name.data(), std::min(name.size(), capacity), out);
+        }
+        return name.size();
+    }
+
+    template <typename...,
+              std::size_t TSize = detail::EnumRange<T>::value,
+              typename std::enable_if<TSize != 0, bool>::type = true>
+    static constexpr bool isValid(const T value) noexcept {
+        return detail::isValidValue<T>(static_cast<UnderlyingType>(value), detail::IsContiguous<T>{});
     }
 
+    /// Checks whether `value` would be a valid value of T after a cast
     template <typename...,
               std::size_t TSize = detail::EnumRange<T>::value,
               typename std::enable_if<TSize != 0, bool>::type = true>
-    static constexpr auto names() noexcept {
-        return detail::getNames<T>();
+    static constexpr bool isValid(const UnderlyingType value) noexcept {
+        return detail::isValidValue<T>(value, detail::IsContiguous<T>{});
     }
 
+    /// Checks a whole array of raw values at once. Returns the position of the first value which is not
+    /// a valid value of T, or `size` if all of them are valid.
     template <typename...,
               std::size_t TSize = detail::EnumRange<T>::value,
               typename std::enable_if<TSize != 0, bool>::type = true>
-    static constexpr StaticString name(const T value) noexcept {
-        constexpr auto values = detail::EnumValues<T>::value;
-        const auto it = std::find(std::begin(values), std::end(values), value);
-        if (it == std::end(values)) {
-            return "";
+    static std::size_t validate(const UnderlyingType* values, const std::size_t size) noexcept {
+        // branch-free blocks of 64 values, the exact position is only looked up in a failing block
+        std::size_t block = 0;
+        for (; block + 64 <= size; block += 64) {
+            std::uint64_t invalid = 0;
+            for (std::size_t i = 0; i < 64; ++i) {
+                invalid |= static_cast<std::uint64_t>(!isValid(values[block + i])) << i;
+            }
+            if (invalid != 0) {
+                return block + detail::countTrailingZeros(invalid);
+            }
+        }
+        for (; block < size; ++block) {
+            if (!isValid(values[block])) {
+                return block;
+            }
         }
-        return detail::getNames<T>()[std::distance(std::begin(values), it)];
+        return size;
+    }
+
+    /// Position of `value` in values(), or count() if `value` is not valid
+    template <typename...,
+              std::size_t TSize = detail::EnumRange<T>::value,
+              typename std::enable_if<TSize != 0, bool>::type = true>
+    static constexpr std::size_t index(const T value) noexcept {
+        return detail::getIndex<T>(static_cast<UnderlyingType>(value), detail::IsContiguous<T>{});
+    }
+
+    /// The value at position `index` in values(), or Invalid if `index` is not lower than count()
+    template <typename...,
+              std::size_t TSize = detail::EnumRange<T>::value,
+              typename std::enable_if<TSize != 0, bool>::type = true>
+    static constexpr T fromIndex(const std::size_t index) noexcept {
+        return index < detail::EnumCount<T>::value ? detail::getValue<T>(index, detail::IsContiguous<T>{})
+                                                   : Invalid;
     }
 
     template <typename...,
               std::size_t TSize = detail::EnumRange<T>::value,
               typename std::enable_if<TSize != 0, bool>::type = true>
     static constexpr T fromStr(const char* name) noexcept {
-        constexpr auto names = detail::getNames<T>();
-        constexpr auto values = detail::EnumValues<T>::value;
-        for (std::size_t i = 0; i < names.size(); ++i) {
-            if (name == names[i]) {
-                return values[i];
+        std::uint64_t hash = detail::HashOffset;
+        std::size_t size = 0;
+        for (; name[size] != 0; ++size) {
+            hash = detail::hashStep(hash, name[size]);
+        }
+        return fromHashed(name, size, detail::hashFinish(hash));
+    }
+
+    template <typename...,
+              std::size_t TSize = detail::EnumRange<T>::value,
+              typename std::enable_if<TSize != 0, bool>::type = true>
+    static constexpr T fromStr(const char* name, const std::size_t size) noexcept {
+        return fromHashed(name, size, detail::hashString(name, size));
+    }
+
+    template <typename...,
+              std::size_t TSize = detail::EnumRange<T>::value,
+              typename std::enable_if<TSize != 0, bool>::type = true>
+    static constexpr T fromStr(const StringView name) noexcept {
+        return fromHashed(name.data(), name.size(), detail::hashString(name.data(), name.size()));
+    }
+
+    /// Lenient parsing, e.g. `fromStr("FRUITS_APPLES", ParsePolicy<IgnoreCase>("fruits_"))`. The names of
+    /// T are normalized at compile time, a lookup normalizes `name` into a stack buffer and then costs the
+    /// same as an exact match. The normalized names must still be distinct.
+    template <unsigned TOptions,
+              std::size_t TSize = detail::EnumRange<T>::value,
+              typename std::enable_if<TSize != 0, bool>::type = true>
+    static constexpr T
+    fromStr(const char* name, const std::size_t size, const ParsePolicy<TOptions> policy) noexcept {
+        std::uint64_t start = lookupStart(); // not const, which would make the initializer constant-evaluated
+        const std::size_t index = findNormalized(name, size, policy);
+        return counted(index, start);
+    }
+
+    template <unsigned TOptions,
+              std::size_t TSize = detail::EnumRange<T>::value,
+              typename std::enable_if<TSize != 0, bool>::type = true>
+    static constexpr T fromStr(const StringView name, const ParsePolicy<TOptions> policy) noexcept {
+        return fromStr(name.data(), name.size(), policy);
+    }
+
+    template <unsigned TOptions,
+              std::size_t TSize = detail::EnumRange<T>::value,
+              typename std::enable_if<TSize != 0, bool>::type = true>
+    static constexpr T fromStr(const char* name, const ParsePolicy<TOptions> policy) noexcept {
+        return fromStr(name, detail::cstrlen(name), policy);
+    }
+
+    /// Values whose names start with `prefix`, ordered by name (e.g. for completion). A value is listed
+    /// again for each of its aliases (see EnumAliasTraits) with the prefix. The view points to static
+    /// storage.
+    template <typename...,
+              std::size_t TSize = detail::EnumRange<T>::value,
+              typename std::enable_if<TSize != 0, bool>::type = true>
+    static constexpr ArrayView<T> withPrefix(const StringView prefix) noexcept {
+        using Sorted = detail::EnumSortedNames<T>;
+        std::size_t begin = 0;
+        std::size_t end = Sorted::size;
+        for (std::size_t k = 0; k < prefix.size() && begin < end; ++k) {
+            Sorted::narrow(begin, end, k, static_cast<unsigned char>(prefix[k]));
+        }
+        return ArrayView<T>(Sorted::values.data + begin, end - begin);
+    }
+
+    template <typename...,
+              std::size_t TSize = detail::EnumRange<T>::value,
+              typename std::enable_if<TSize != 0, bool>::type = true>
+    static constexpr ArrayView<T> withPrefix(const char* prefix) noexcept {
+        return withPrefix(StringView(prefix, detail::cstrlen(prefix)));
+    }
+
+    /// Parses the longest name or alias at the start of `str` (which does not need to end after it).
+    /// Returns the number of characters it used and stores its value in `value`, or returns 0 and stores
+    /// Invalid if `str` does not start with any name.
+    template <typename...,
+              std::size_t TSize = detail::EnumRange<T>::value,
+              typename std::enable_if<TSize != 0, bool>::type = true>
+    static constexpr std::size_t fromStrPrefix(const char* str, const std::size_t size, T& value) noexcept {
+        using Sorted = detail::EnumSortedNames<T>;
+        std::size_t begin = 0;
+        std::size_t end = Sorted::size;
+        std::size_t matched = 0;
+        value = Invalid;
+        for (std::size_t k = 0; begin < end; ++k) {
+            // a name of exactly k characters sorts first among the names sharing their first k characters
+            if (Sorted::get(begin).size() == k) {
+                matched = k;
+                value = Sorted::values[begin];
+            }
+            if (k == size) {
+                break;
+            }
+            Sorted::narrow(begin, end, k, static_cast<unsigned char>(str[k]));
+        }
+        return matched;
+    }
+
+    /// Parses `count` names at once. out[i] is set to the parsed value (or Invalid) and bit i of `missMask`,
+    /// an array of (count + 63) / 64 words, is set for every name which is not known. Returns the number
+    /// of misses.
+    /// Faster than calling fromStr() in a loop: when the keys of T differ in their length or their first,
+    /// middle or last character (checked at compile time), the names are bucketed by these alone instead
+    /// of hashing all their characters. The candidates of a block of 64 names are looked up before any of
+    /// them is compared, so the table loads of different names overlap.
+    template <typename...,
+              std::size_t TSize = detail::EnumRange<T>::value,
+              typename std::enable_if<TSize != 0, bool>::type = true>
+    static std::size_t
+    fromStrBatch(const StringView* names, const std::size_t count, T* out, std::uint64_t* missMask) noexcept {
+        using Keys = detail::EnumKeys<T>;
+        using Hash = typename std::conditional<detail::hasDistinctSamples<Keys>(),
+                                               detail::SampledHash,
+                                               detail::StringHash>::type;
+        using Lookup = detail::PerfectHash<Keys, Hash>;
+
+        std::size_t misses = 0;
+        for (std::size_t block = 0; block < count; block += 64) {
+            const std::size_t blockSize = std::min<std::size_t>(64, count - block);
+            std::size_t candidates[64];
+            for (std::size_t i = 0; i < blockSize; ++i) {
+                const StringView name = names[block + i];
+                candidates[i] = Lookup::candidate(Hash::hash(name.data(), name.size()));
+            }
+
+            std::uint64_t miss = 0;
+            for (std::size_t i = 0; i < blockSize; ++i) {
+                const StringView name = names[block + i];
+                const bool hit = Lookup::matches(candidates[i], name.data(), name.size());
+                const std::size_t index = detail::getKeyIndex<T>(candidates[i], detail::HasAliases<T>{});
+                out[block + i] = hit ? detail::getValue<T>(index, detail::IsContiguous<T>{}) : Invalid;
+                miss |= static_cast<std::uint64_t>(!hit) << i;
+            }
+            missMask[block / 64] = miss;
+            misses += detail::popCount(miss);
+        }
+#if ENUM_TRAITS_INSTRUMENTATION
+        detail::EnumStats<T>::record(detail::EnumEvent::Hit, count - misses);
+        detail::EnumStats<T>::record(detail::EnumEvent::Miss, misses);
+#endif
+        return misses;
+    }
+
+    /// Looks up the names of `count` values at once. The name of values[i] starts at
+    /// `namePool() + offsets[i]` and is `lengths[i]` characters long (and NUL-terminated); invalid values
+    /// get an empty name. The loop has no branches, just a range check and table loads per value.
+    template <typename...,
+              std::size_t TSize = detail::EnumRange<T>::value,
+              typename std::enable_if<TSize != 0, bool>::type = true>
+    static void namesBatch(const T* values,
+                           const std::size_t count,
+                           std::uint32_t* offsets,
+                           std::uint32_t* lengths) noexcept {
+        for (std::size_t i = 0; i < count; ++i) {
+            const std::size_t index = EnumTraits::index(values[i]);
+            offsets[i] = detail::EnumNames<T>::offsets[index];
+            lengths[i] = detail::EnumNames<T>::lengths[index];
+        }
+    }
+
+    /// Storage of all names, see namesBatch()
+    template <typename...,
+              std::size_t TSize = detail::EnumRange<T>::value,
+              typename std::enable_if<TSize != 0, bool>::type = true>
+    static constexpr const char* namePool() noexcept {
+        return detail::EnumNames<T>::pool.data;
+    }
+
+private:
+    template <typename>
+    friend class EnumAliasRegistry;
+
+    static constexpr T
+    fromHashed(const char* name, const std::size_t size, const std::uint64_t hash) noexcept {
+        std::uint64_t start = lookupStart(); // not const, which would make the initializer constant-evaluated
+        return counted(findIndex(name, size, hash), start);
+    }
+
+    /// Position of the value named `name` (or one of its aliases), or count() if there is none. The
+    /// lookup is not counted.
+    static constexpr std::size_t
+    findIndex(const char* name, const std::size_t size, const std::uint64_t hash) noexcept {
+        const std::size_t key = detail::PerfectHash<detail::EnumKeys<T>>::find(name, size, hash);
+        return detail::getKeyIndex<T>(key, detail::HasAliases<T>{});
+    }
+
+    /// Position of the value whose normalized name matches `name`, or count() if there is none
+    template <unsigned TOptions>
+    static constexpr std::size_t
+    findNormalized(const char* name, const std::size_t size, const ParsePolicy<TOptions> policy) noexcept {
+        using Keys = detail::NamePool<detail::EnumNormalizedNames<T, TOptions>>;
+        constexpr std::size_t maxLength = detail::KeyFilter<Keys>::maxLength;
+
+        char normalized[maxLength + 1] = {};
+        std::size_t length = 0;
+        for (std::size_t i = detail::skipPrefix<TOptions>(name, size, policy.prefix()); i < size; ++i) {
+            if (detail::isSkipped<TOptions>(name[i])) {
+                continue;
             }
+            if (length == maxLength) {
+                return count();
+            }
+            normalized[length++] = detail::normalize<TOptions>(name[i]);
         }
-        return static_cast<T>(Invalid);
+        return detail::PerfectHash<Keys>::find(normalized, length, detail::hashString(normalized, length));
+    }
+
+    /// Start of a fromStr() lookup for the latency histogram, 0 if the lookup is not timed
+    static constexpr std::uint64_t lookupStart() noexcept {
+#if ENUM_TRAITS_INSTRUMENTATION
+        return detail::isConstantEvaluated() ? 0 : detail::EnumStats<T>::startLookup();
+#else
+        return 0;
+#endif
+    }
+
+    /// Counts a fromStr() lookup started at `start`
+    static constexpr void countLookup(const bool hit, const std::uint64_t start) noexcept {
+#if ENUM_TRAITS_INSTRUMENTATION
+        if (!detail::isConstantEvaluated()) {
+            detail::EnumStats<T>::finishLookup(hit, start);
+        }
+#else
+        static_cast<void>(hit);
+        static_cast<void>(start);
+#endif
+    }
+
+    /// The value at `index` (or Invalid if `index` is count()), counting the fromStr() lookup which found it
+    static constexpr T counted(const std::size_t index, const std::uint64_t start) noexcept {
+        countLookup(index < count(), start);
+        return fromIndex(index);
     }
 };
 
@@ -502,4 +2105,39 @@ constexpr typename EnumTraits<T>::ValueType EnumTraits<T>::Invalid;
 
 } // namespace etraits
 
+#if ENUM_TRAITS_INSTRUMENTATION
+#include "enum-traits/enum-stats.hpp"
+#endif
+
+/// Sets the range of values scanned for the enumerators of TEnum (see etraits::EnumRangeTraits).
+/// Must be used in the global namespace.
+#define ENUM_TRAITS_RANGE(TEnum, TMin, TMax)                                                                 \
+    namespace etraits {                                                                                      \
+    template <>                                                                                              \
+    struct EnumRangeTraits<TEnum> {                                                                          \
+        static constexpr auto min = TMin;                                                                    \
+        static constexpr auto max = TMax;                                                                    \
+    };                                                                                                       \
+    }
+
+/// Adds aliases accepted by the lookups of TEnum (see etraits::EnumAliasTraits), e.g.
+/// `ENUM_TRAITS_ALIASES(Fruits, { "Banana", Fruits::Bananas }, { "Apple", Fruits::Apples })`.
+/// Must be used in the global namespace.
+#define ENUM_TRAITS_ALIASES(TEnum, ...)                                                                      \
+    namespace etraits {                                                                                      \
+    template <>                                                                                              \
+    struct EnumAliasTraits<TEnum> {                                                                          \
+        static constexpr EnumAlias<TEnum> aliases[] = { __VA_ARGS__ };                                       \
+    };                                                                                                       \
+    }
+
+/// Scans only the given windows for the enumerators of TEnum (see etraits::EnumWindows), e.g.
+/// `ENUM_TRAITS_WINDOWS(Protocol, EnumWindow<0, 20>, EnumWindow<1000, 1040>)`.
+/// Must be used in the global namespace.
+#define ENUM_TRAITS_WINDOWS(TEnum, ...)                                                                      \
+    namespace etraits {                                                                                      \
+    template <>                                                                                              \
+    struct EnumRangeTraits<TEnum> : EnumWindows<__VA_ARGS__> {};                                             \
+    }
+
 #endif // ENUM_TRAITS_ENUM_TRAITS_HPP_
@@ -3,13 +3,46 @@
 #undef ENUM_TRAITS_MIN_ENUM_VALUE // std::numeric_limits<int8_t>::min()
 #undef ENUM_TRAITS_MAX_ENUM_VALUE // std::numeric_limits<int8_t>::max()
 
+#include "enum-traits/enum-aliases.hpp"
+#include "enum-traits/enum-codec.hpp"
+#include "enum-traits/enum-containers.hpp"
+#include "enum-traits/enum-convert.hpp"
+#include "enum-traits/enum-extern.hpp"
+#include "enum-traits/enum-flags.hpp"
+#include "enum-traits/enum-stats.hpp"
+#include "enum-traits/enum-stream.hpp"
 #include "enum-traits/enum-traits.hpp"
 
 #include <gmock/gmock.h>
 
+#include <cstring>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
 using namespace etraits;
 
 using ::testing::ElementsAre;
+using ::testing::EndsWith;
+using ::testing::HasSubstr;
+
+enum class Ports { Http = 1080, Https = 1443, Ssh = 1022 };
+ENUM_TRAITS_RANGE(Ports, 1000, 1500)
+
+enum class Levels { Low, Medium, High, Max = 100 };
+ENUM_TRAITS_RANGE(Levels, 0, 3)
+
+enum class Messages : uint16_t { Hello = 0, Bye = 20, Get = 1000, Put = 1040, Ext = 0x8000, ExtEnd = 0x8010 };
+ENUM_TRAITS_WINDOWS(Messages, EnumWindow<0, 20>, EnumWindow<1000, 1040>, EnumWindow<0x8000, 0x8010>)
+
+enum class Groceries { Apples = 2, Oranges = 5, Pears = 8, Bananas = 11 };
+ENUM_TRAITS_ALIASES(Groceries, { "Banana", Groceries::Bananas }, { "Apple", Groceries::Apples })
+
+// Usually ENUM_TRAITS_DECLARE is in a header and ENUM_TRAITS_DEFINE in a single .cpp
+enum class Planets { Mercury = -3, Venus = 0, Earth = 4, Mars = 9 };
+ENUM_TRAITS_DECLARE(Planets)
+ENUM_TRAITS_DEFINE(Planets)
 
 TEST(enumTraits, minMax) {
     enum class Fruits { Apples = 2, Oranges = 5, Pears = 8, Bananas = 11 };
@@ -26,8 +59,14 @@ TEST(enumTraits, minMax) {
 
     enum Dogs : uint8_t { Bulldog, Poodle, Rottweiler, Husky = 255 };
     EXPECT_EQ(EnumTraits<Dogs>::min(), 0);
-    EXPECT_EQ(EnumTraits<Dogs>::max(), 2); // Husky doesn't fit into the allowed maximum
-                                           // of int8_t (127), next one is Rottweiler (2)
+    EXPECT_EQ(EnumTraits<Dogs>::max(), 255); // byte-sized enums are scanned over their whole domain
+    EXPECT_EQ(EnumTraits<Dogs>::name(Husky), "Husky");
+    EXPECT_EQ(EnumTraits<Dogs>::fromStr("Rottweiler"), Rottweiler);
+    // Husky is also Invalid, so whether fromStr() found it is only told by the matched length
+    Dogs dog = Bulldog;
+    EXPECT_EQ(EnumTraits<Dogs>::fromStrPrefix("Husky", 5, dog), 5U);
+    EXPECT_EQ(dog, Husky);
+    EXPECT_EQ(EnumTraits<Dogs>::fromStrPrefix("Huskie", 6, dog), 0U);
 
     enum class Cats : int64_t { British = -7, Persian = -6, Bengal = -5, Siberian = -4 };
     EXPECT_EQ(EnumTraits<Cats>::min(), -7);
@@ -39,6 +78,17 @@ TEST(enumTraits, minMax) {
 
 }
 
+TEST(enumTraits, customRange) {
+    EXPECT_EQ(EnumTraits<Ports>::min(), 1022);
+    EXPECT_EQ(EnumTraits<Ports>::max(), 1443);
+    EXPECT_THAT(EnumTraits<Ports>::names(), ElementsAre("Ssh", "Http", "Https"));
+    EXPECT_EQ(EnumTraits<Ports>::fromStr("Https"), Ports::Https);
+
+    EXPECT_EQ(EnumTraits<Levels>::max(), 2); // Max lies outside of the scanned range
+    EXPECT_THAT(EnumTraits<Levels>::values(), ElementsAre(Levels::Low, Levels::Medium, Levels::High));
+    EXPECT_EQ(EnumTraits<Levels>::name(Levels::Max), "");
+}
+
 TEST(enumTraits, values) {
     {
         enum class Fruits { Apples = 2, Oranges = 5, Pears = 8, Bananas = 11 };
@@ -59,11 +109,93 @@ TEST(enumTraits, values) {
     }
 }
 
+TEST(enumTraits, defaultRangeIsClamped) {
+    static_assert(detail::clampTo<uint8_t>(-1000) == 0, "");
+    static_assert(detail::clampTo<uint8_t>(1000) == 255, "");
+    static_assert(detail::clampTo<int8_t>(-1000) == -128, "");
+    static_assert(detail::clampTo<int8_t>(100) == 100, "");
+    static_assert(detail::clampTo<uint32_t>(-1) == 0, "");
+    static_assert(detail::clampTo<int64_t>(-1000) == -1000, "");
+
+    static_assert(detail::clampTo<uint8_t>(std::numeric_limits<int8_t>::max()) == 127, "");
+    static_assert(detail::defaultBound<uint8_t>(std::numeric_limits<int8_t>::max(), false) == 255, "");
+    static_assert(detail::defaultBound<int16_t>(std::numeric_limits<int8_t>::max(), false) == 127, "");
+
+    enum class Bytes : uint8_t { Low = 1, High = 100, Top = 255 };
+    static_assert(EnumRangeTraits<Bytes>::min == 0 && EnumRangeTraits<Bytes>::max == 255, "");
+    EXPECT_EQ(EnumTraits<Bytes>::min(), 1);
+    EXPECT_EQ(EnumTraits<Bytes>::max(), 255);
+    EXPECT_EQ(EnumTraits<Bytes>::count(), 3U);
+
+    enum class Letters : char { A = 'A', Z = 'Z', Tilde = '~' };
+    EXPECT_THAT(EnumTraits<Letters>::names(), ElementsAre("A", "Z", "Tilde"));
+    enum class Signed : signed char { Min = -128, Max = 127 };
+    EXPECT_EQ(EnumTraits<Signed>::count(), 2U);
+}
+
+TEST(enumTraits, contiguous) {
+    enum class Fruits { Apples = -2, Oranges, Pears, Bananas };
+    using Traits = EnumTraits<Fruits>;
+    static_assert(Traits::isContiguous(), "");
+    static_assert(std::is_same<decltype(Traits::values()), ContiguousValues<Fruits>>::value, "");
+    static_assert(Traits::values().size() == 4 && Traits::values()[3] == Fruits::Bananas, "");
+    EXPECT_THAT(Traits::values(),
+                ElementsAre(Fruits::Apples, Fruits::Oranges, Fruits::Pears, Fruits::Bananas));
+    using Category = std::iterator_traits<ContiguousValues<Fruits>::Iterator>::iterator_category;
+    static_assert(std::is_same<Category, std::input_iterator_tag>::value, "");
+    const std::vector<Fruits> copied(Traits::values().begin(), Traits::values().end());
+    EXPECT_THAT(copied, ElementsAre(Fruits::Apples, Fruits::Oranges, Fruits::Pears, Fruits::Bananas));
+    static_assert(Traits::index(Fruits::Pears) == 2, "");
+    static_assert(Traits::index(static_cast<Fruits>(-3)) == 4, "");
+    static_assert(Traits::fromIndex(1) == Fruits::Oranges, "");
+    static_assert(Traits::isValid(-2) && !Traits::isValid(-3) && !Traits::isValid(2), "");
+    EXPECT_EQ(Traits::name(Fruits::Bananas), "Bananas");
+    EXPECT_EQ(Traits::name(static_cast<Fruits>(2)), "");
+    EXPECT_EQ(Traits::fromStr("Pears"), Fruits::Pears);
+
+    enum class Ends : int8_t { Min = -128, Next };
+    static_assert(EnumTraits<Ends>::isContiguous(), "");
+    EXPECT_EQ(EnumTraits<Ends>::name(static_cast<Ends>(127)), "");
+    EXPECT_EQ(EnumTraits<Ends>::name(Ends::Next), "Next");
+
+    static_assert(EnumTraits<Levels>::isContiguous(), ""); // Max is out of its range
+    static_assert(!EnumTraits<Messages>::isContiguous(), "");
+    enum class Gap { A = 20, B = 22 };
+    static_assert(!EnumTraits<Gap>::isContiguous(), "");
+    EXPECT_THAT(EnumTraits<Gap>::values(), ElementsAre(Gap::A, Gap::B));
+}
+
+TEST(enumTraits, windows) {
+    using Traits = EnumTraits<Messages>;
+    static_assert(detail::EnumScan<Messages>::size == 21 + 41 + 17, "");
+    EXPECT_EQ(Traits::min(), 0);
+    EXPECT_EQ(Traits::max(), 0x8010);
+    EXPECT_EQ(Traits::count(), 6U);
+    EXPECT_THAT(Traits::values(),
+                ElementsAre(Messages::Hello, Messages::Bye, Messages::Get, Messages::Put, Messages::Ext,
+                            Messages::ExtEnd));
+    EXPECT_THAT(Traits::names(), ElementsAre("Hello", "Bye", "Get", "Put", "Ext", "ExtEnd"));
+
+    EXPECT_EQ(Traits::name(Messages::Put), "Put");
+    EXPECT_EQ(Traits::name(Messages::ExtEnd), "ExtEnd");
+    EXPECT_EQ(Traits::name(static_cast<Messages>(5)), "");
+    EXPECT_EQ(Traits::name(static_cast<Messages>(500)), "");
+    EXPECT_EQ(Traits::name(static_cast<Messages>(0xFFFF)), "");
+    EXPECT_TRUE(Traits::isValid(Messages::Get));
+    EXPECT_FALSE(Traits::isValid(static_cast<uint16_t>(1001)));
+    EXPECT_FALSE(Traits::isValid(static_cast<uint16_t>(2000)));
+    EXPECT_EQ(Traits::index(Messages::Ext), 4U);
+    EXPECT_EQ(Traits::fromStr("Ext"), Messages::Ext);
+    static_assert(Traits::name(Messages::Get) == "Get", "");
+}
+
 TEST(enumTraits, names) {
     {
         enum class Fruits { Apples = 2, Oranges = 5, Pears = 8, Bananas = 11 };
         constexpr auto names = EnumTraits<Fruits>::names();
         EXPECT_THAT(names, ElementsAre("Apples", "Oranges", "Pears", "Bananas"));
+        EXPECT_EQ(names[2].size(), 5U);
+        EXPECT_STREQ(names[2].c_str(), "Pears");
     }
 
     {
@@ -86,11 +218,44 @@ TEST(enumTraits, name) {
     EXPECT_EQ(EnumTraits<Fruits>::name(Fruits::Pears), "Pears");
     EXPECT_EQ(EnumTraits<Fruits>::name(Fruits::Bananas), "Bananas");
     EXPECT_EQ(EnumTraits<Fruits>::name(static_cast<Fruits>(42)), "");
+    EXPECT_EQ(EnumTraits<Fruits>::name(static_cast<Fruits>(3)), "");
+    EXPECT_EQ(EnumTraits<Fruits>::name(static_cast<Fruits>(-100)), "");
+    static_assert(EnumTraits<Fruits>::name(Fruits::Pears) == "Pears", "");
 
     enum class Cities { Prague = -127, Berlin = 126 };
     EXPECT_EQ(EnumTraits<Cities>::name(Cities::Prague), "Prague");
     EXPECT_EQ(EnumTraits<Cities>::name(Cities::Berlin), "Berlin");
     EXPECT_EQ(EnumTraits<Cities>::name(static_cast<Cities>(42)), "");
+
+    // far outside of the range, these must not alias a valid slot when std::size_t has 32 bits
+    enum class Big : int64_t { Small = 0, Medium = 2, Large = 5 };
+    enum class BigUnsigned : uint64_t { Small = 0, Medium = 2, Large = 5 };
+    constexpr auto beyond = static_cast<int64_t>(1) << 32;
+    static_assert(!EnumTraits<Big>::isValid(static_cast<Big>(beyond + 2)), "");
+    static_assert(EnumTraits<Big>::name(static_cast<Big>(beyond + 5)).empty(), "");
+    static_assert(EnumTraits<Big>::name(static_cast<Big>(-beyond)).empty(), "");
+    static_assert(!EnumTraits<BigUnsigned>::isValid(static_cast<BigUnsigned>(beyond + 2)), "");
+    EXPECT_EQ(EnumTraits<BigUnsigned>::name(static_cast<BigUnsigned>(beyond * 4 + 5)), "");
+    EXPECT_EQ(EnumTraits<Big>::name(Big::Large), "Large");
+}
+
+TEST(enumTraits, writeName) {
+    enum class Fruits { Apples = 2, Oranges = 5, Pears = 8, Bananas = 11 };
+    char buffer[8] = { 'x', 'x', 'x', 'x', 'x', 'x', 'x', 'x' };
+    EXPECT_EQ(EnumTraits<Fruits>::writeName(Fruits::Pears, buffer, sizeof(buffer)), 5U);
+    EXPECT_EQ(std::string(buffer, 6), "Pearsx");
+    EXPECT_EQ(EnumTraits<Fruits>::writeName(Fruits::Oranges, buffer, 3), 7U);
+    EXPECT_EQ(std::string(buffer, 6), "Orarsx");
+    EXPECT_EQ(EnumTraits<Fruits>::writeName(static_cast<Fruits>(3), buffer, sizeof(buffer)), 0U);
+    EXPECT_EQ(EnumTraits<Fruits>::writeName(Fruits::Apples, nullptr, 0), 6U);
+}
+
+TEST(enumTraits, stream) {
+    enum class Fruits { Apples = 2, Oranges = 5, Pears = 8, Bananas = 11 };
+    std::ostringstream os;
+    os << nameOf(Fruits::Pears) << ',' << nameOf(static_cast<Fruits>(3)) << ','
+       << EnumTraits<Fruits>::name(Fruits::Bananas);
+    EXPECT_EQ(os.str(), "Pears,,Bananas");
 }
 
 TEST(enumTraits, fromStr) {
@@ -100,6 +265,529 @@ TEST(enumTraits, fromStr) {
     EXPECT_EQ(EnumTraits<Fruits>::fromStr("Pears"), Fruits::Pears);
     EXPECT_EQ(EnumTraits<Fruits>::fromStr("Bananas"), Fruits::Bananas);
     EXPECT_EQ(EnumTraits<Fruits>::fromStr("non-existing"), EnumTraits<Fruits>::Invalid);
+    EXPECT_EQ(EnumTraits<Fruits>::fromStr(""), EnumTraits<Fruits>::Invalid);
+    EXPECT_EQ(EnumTraits<Fruits>::fromStr("Apple"), EnumTraits<Fruits>::Invalid);
+    EXPECT_EQ(EnumTraits<Fruits>::fromStr("Appless"), EnumTraits<Fruits>::Invalid);
+    static_assert(EnumTraits<Fruits>::fromStr("Pears") == Fruits::Pears, "");
+
+    const char buffer[] = "PearsBananasOranges";
+    EXPECT_EQ(EnumTraits<Fruits>::fromStr(buffer, 5), Fruits::Pears);
+    EXPECT_EQ(EnumTraits<Fruits>::fromStr(buffer + 5, 7), Fruits::Bananas);
+    EXPECT_EQ(EnumTraits<Fruits>::fromStr(StringView(buffer + 12, 7)), Fruits::Oranges);
+    EXPECT_EQ(EnumTraits<Fruits>::fromStr(buffer, 6), EnumTraits<Fruits>::Invalid);
+
+    enum class Letters { A, B, C, D, E, F, G, H, I, J, K, L, M, N, O, P, Q, R, S, T, U, V, W, X, Y, Z,
+                         AA, BB, CC, DD, EE, FF, GG, HH, II, JJ, KK, LL, MM, NN, OO, PP, QQ, RR, SS, TT };
+    for (const Letters letter : EnumTraits<Letters>::values()) {
+        EXPECT_EQ(EnumTraits<Letters>::fromStr(EnumTraits<Letters>::name(letter).c_str()), letter);
+    }
+    EXPECT_EQ(EnumTraits<Letters>::fromStr("AAA"), EnumTraits<Letters>::Invalid);
+    EXPECT_EQ(EnumTraits<Letters>::fromStr("a"), EnumTraits<Letters>::Invalid);
+}
+
+TEST(enumTraits, fromStrPolicies) {
+    enum class Fruits { Apples = 2, Oranges = 5, PassionFruits = 8, Bananas = 11 };
+    using Traits = EnumTraits<Fruits>;
+    const ParsePolicy<IgnoreCase> ignoreCase;
+    EXPECT_EQ(Traits::fromStr("apples", ignoreCase), Fruits::Apples);
+    EXPECT_EQ(Traits::fromStr("APPLES", ignoreCase), Fruits::Apples);
+    EXPECT_EQ(Traits::fromStr("passionfruits", ignoreCase), Fruits::PassionFruits);
+    EXPECT_EQ(Traits::fromStr("passion_fruits", ignoreCase), Traits::Invalid);
+    EXPECT_EQ(Traits::fromStr("Apple", ignoreCase), Traits::Invalid);
+    EXPECT_EQ(Traits::fromStr("", ignoreCase), Traits::Invalid);
+    EXPECT_EQ(Traits::fromStr("applesapplesapplesapplesapplesapples", ignoreCase), Traits::Invalid);
+    static_assert(Traits::fromStr("BANANAS", ParsePolicy<IgnoreCase>()) == Fruits::Bananas, "");
+
+    const ParsePolicy<IgnoreCase | IgnoreUnderscores> snakeCase("fruits_");
+    EXPECT_EQ(Traits::fromStr("passion_fruits", snakeCase), Fruits::PassionFruits);
+    EXPECT_EQ(Traits::fromStr("PASSION_FRUITS", snakeCase), Fruits::PassionFruits);
+    EXPECT_EQ(Traits::fromStr("FRUITS_APPLES", snakeCase), Fruits::Apples);
+    EXPECT_EQ(Traits::fromStr(StringView("FruitsOranges!", 13), snakeCase), Fruits::Oranges);
+    EXPECT_EQ(Traits::fromStr("fruits_", snakeCase), Traits::Invalid);
+
+    enum class Colors { kColorRed, kColorGreen, kColorBlue };
+    const ParsePolicy<StripCommonPrefix> stripped;
+    EXPECT_EQ(EnumTraits<Colors>::fromStr("Green", stripped), Colors::kColorGreen);
+    EXPECT_EQ(EnumTraits<Colors>::fromStr("kColorGreen", stripped), EnumTraits<Colors>::Invalid);
+    EXPECT_EQ(EnumTraits<Colors>::fromStr("blue", ParsePolicy<StripCommonPrefix | IgnoreCase>()),
+              Colors::kColorBlue);
+
+    // a name which is the whole common prefix keeps it
+    enum class Prefixed { Foo, FooBar, FooBaz };
+    EXPECT_EQ(EnumTraits<Prefixed>::fromStr("Foo", stripped), Prefixed::Foo);
+    EXPECT_EQ(EnumTraits<Prefixed>::fromStr("", stripped), EnumTraits<Prefixed>::Invalid);
+    EXPECT_EQ(EnumTraits<Prefixed>::fromStr("FooBar", stripped), Prefixed::FooBar);
+
+    // the prefix is only stripped at a word boundary
+    enum class Orchard { Apples, Apricots };
+    EXPECT_EQ(EnumTraits<Orchard>::fromStr("ples", stripped), EnumTraits<Orchard>::Invalid);
+    EXPECT_EQ(EnumTraits<Orchard>::fromStr("Apricots", stripped), Orchard::Apricots);
+    enum class Codes { CODE_NOT_FOUND, CODE_NOT_ALLOWED };
+    const ParsePolicy<StripCommonPrefix | IgnoreCase | IgnoreUnderscores> lenient;
+    EXPECT_EQ(EnumTraits<Codes>::fromStr("FOUND", stripped), Codes::CODE_NOT_FOUND);
+    EXPECT_EQ(EnumTraits<Codes>::fromStr("OUND", stripped), EnumTraits<Codes>::Invalid);
+    EXPECT_EQ(EnumTraits<Codes>::fromStr("Allowed", lenient), Codes::CODE_NOT_ALLOWED);
+}
+
+TEST(enumTraits, prefix) {
+    enum class Commands { Get = 3, GetAll = 1, Go = 7, Put = 2, Post = 5, G = 9 };
+    using Traits = EnumTraits<Commands>;
+    EXPECT_THAT(Traits::withPrefix("Ge"), ElementsAre(Commands::Get, Commands::GetAll));
+    EXPECT_THAT(Traits::withPrefix("G"),
+                ElementsAre(Commands::G, Commands::Get, Commands::GetAll, Commands::Go));
+    EXPECT_THAT(Traits::withPrefix("P"), ElementsAre(Commands::Post, Commands::Put));
+    EXPECT_THAT(Traits::withPrefix("GetAll"), ElementsAre(Commands::GetAll));
+    EXPECT_EQ(Traits::withPrefix("").size(), 6U);
+    EXPECT_TRUE(Traits::withPrefix("GetAllX").empty());
+    EXPECT_TRUE(Traits::withPrefix("get").empty());
+    static_assert(Traits::withPrefix("Po").size() == 1, "");
+
+    Commands value = Commands::Put;
+    EXPECT_EQ(Traits::fromStrPrefix("GetAll items", 12, value), 6U);
+    EXPECT_EQ(value, Commands::GetAll);
+    EXPECT_EQ(Traits::fromStrPrefix("GetA", 4, value), 3U);
+    EXPECT_EQ(value, Commands::Get);
+    EXPECT_EQ(Traits::fromStrPrefix("Gx", 2, value), 1U);
+    EXPECT_EQ(value, Commands::G);
+    EXPECT_EQ(Traits::fromStrPrefix("Po", 2, value), 0U);
+    EXPECT_EQ(value, Traits::Invalid);
+    EXPECT_EQ(Traits::fromStrPrefix("Put", 0, value), 0U);
+}
+
+TEST(enumTraits, aliases) {
+    using Traits = EnumTraits<Groceries>;
+    EXPECT_EQ(Traits::fromStr("Banana"), Groceries::Bananas);
+    EXPECT_EQ(Traits::fromStr("Bananas"), Groceries::Bananas);
+    EXPECT_EQ(Traits::fromStr(StringView("Apple", 5)), Groceries::Apples);
+    EXPECT_EQ(Traits::fromStr("Pear"), Traits::Invalid);
+    static_assert(Traits::fromStr("Banana") == Groceries::Bananas, "");
+    EXPECT_EQ(Traits::name(Groceries::Bananas), "Bananas");
+    EXPECT_EQ(Traits::count(), 4U);
+
+    EXPECT_THAT(Traits::withPrefix("Ban"), ElementsAre(Groceries::Bananas, Groceries::Bananas));
+    EXPECT_THAT(Traits::withPrefix("A"), ElementsAre(Groceries::Apples, Groceries::Apples));
+    Groceries value = Groceries::Pears;
+    EXPECT_EQ(Traits::fromStrPrefix("Banana split", 12, value), 6U);
+    EXPECT_EQ(value, Groceries::Bananas);
+
+    const StringView names[] = { StringView("Apple", 5), StringView("Kiwi", 4), StringView("Banana", 6) };
+    Groceries values[3];
+    std::uint64_t missMask = 0;
+    EXPECT_EQ(Traits::fromStrBatch(names, 3, values, &missMask), 1U);
+    EXPECT_THAT(values, ElementsAre(Groceries::Apples, Traits::Invalid, Groceries::Bananas));
+    EXPECT_EQ(missMask, 2U);
+}
+
+TEST(enumAliasRegistry, runtime) {
+    using Registry = EnumAliasRegistry<Groceries>;
+    EXPECT_EQ(Registry::fromStr("Pear"), EnumTraits<Groceries>::Invalid);
+    EXPECT_EQ(Registry::fromStr("Banana"), Groceries::Bananas);
+
+    EXPECT_TRUE(Registry::add("Pear", Groceries::Pears));
+    EXPECT_TRUE(Registry::add("Orange", Groceries::Apples));
+    EXPECT_TRUE(Registry::add("Orange", Groceries::Oranges));
+    EXPECT_FALSE(Registry::add("Pears", Groceries::Pears));
+    EXPECT_FALSE(Registry::add("Banana", Groceries::Pears));
+    EXPECT_FALSE(Registry::add("Kiwi", static_cast<Groceries>(3)));
+    EXPECT_EQ(Registry::size(), 2U);
+    EXPECT_EQ(Registry::fromStr("Pear"), Groceries::Pears);
+    EXPECT_EQ(Registry::fromStr("Orange"), Groceries::Oranges);
+    EXPECT_EQ(Registry::fromStr("Oranges"), Groceries::Oranges);
+    EXPECT_EQ(Registry::fromStr("Kiwi"), EnumTraits<Groceries>::Invalid);
+    EXPECT_EQ(EnumTraits<Groceries>::fromStr("Pear"), EnumTraits<Groceries>::Invalid);
+#if ENUM_TRAITS_INSTRUMENTATION
+    // a lookup is counted once, after the runtime aliases; add() does not count
+    const EnumStatsSnapshot before = enumStats<Groceries>();
+    EXPECT_EQ(Registry::fromStr("Pear"), Groceries::Pears);
+    EXPECT_EQ(Registry::fromStr("Kiwi"), EnumTraits<Groceries>::Invalid);
+    EXPECT_EQ(Registry::fromStr("Banana"), Groceries::Bananas);
+    EXPECT_FALSE(Registry::add("Banana", Groceries::Pears));
+    const EnumStatsSnapshot after = enumStats<Groceries>();
+    EXPECT_EQ(after.hits - before.hits, 2U);
+    EXPECT_EQ(after.misses - before.misses, 1U);
+#endif
+
+    // lookups keep working while another thread adds and removes aliases
+    std::thread writer([] {
+        for (int i = 0; i < 200; ++i) {
+            const std::string name = "Legacy" + std::to_string(i);
+            Registry::add(name.c_str(), Groceries::Apples);
+            if (i % 2 == 0) {
+                Registry::remove(name.c_str());
+            }
+        }
+    });
+    for (int i = 0; i < 2000; ++i) {
+        ASSERT_EQ(Registry::fromStr("Pear"), Groceries::Pears);
+    }
+    writer.join();
+    EXPECT_EQ(Registry::size(), 102U);
+    EXPECT_EQ(Registry::fromStr("Legacy99"), Groceries::Apples);
+    EXPECT_EQ(Registry::fromStr("Legacy98"), EnumTraits<Groceries>::Invalid);
+
+    EXPECT_TRUE(Registry::remove("Pear"));
+    EXPECT_FALSE(Registry::remove("Pear"));
+    EXPECT_EQ(Registry::fromStr("Pear"), EnumTraits<Groceries>::Invalid);
+    Registry::clear();
+    EXPECT_EQ(Registry::size(), 0U);
+    EXPECT_EQ(Registry::fromStr("Orange"), EnumTraits<Groceries>::Invalid);
+
+    EXPECT_EQ(Registry::assign({ { "Pear", Groceries::Pears },
+                                 { "Kiwi", static_cast<Groceries>(3) },
+                                 { "Banana", Groceries::Pears },
+                                 { "Orange", Groceries::Apples },
+                                 { "Orange", Groceries::Oranges } }),
+              2U);
+    EXPECT_EQ(Registry::size(), 2U);
+    EXPECT_EQ(Registry::fromStr("Orange"), Groceries::Oranges);
+    EXPECT_EQ(Registry::fromStr("Pear"), Groceries::Pears);
+    EXPECT_EQ(Registry::fromStr("Banana"), Groceries::Bananas);
+    EXPECT_EQ(Registry::fromStr("Kiwi"), EnumTraits<Groceries>::Invalid);
+    EXPECT_EQ(Registry::assign({}), 0U);
+    EXPECT_EQ(Registry::size(), 0U);
+}
+
+TEST(enumTraits, batch) {
+    enum class Fruits { Apples = 2, Oranges = 5, Pears = 8, Bananas = 11 };
+    const char* const strings[] = { "Pears", "Kiwis", "Apples", "", "Bananas", "pears", "Oranges" };
+    std::vector<StringView> names;
+    for (std::size_t i = 0; i < 100; ++i) {
+        const char* str = strings[i % 7];
+        names.emplace_back(str, std::strlen(str));
+    }
+
+    std::vector<Fruits> values(names.size());
+    std::vector<std::uint64_t> missMask(2);
+    EXPECT_EQ(EnumTraits<Fruits>::fromStrBatch(names.data(), names.size(), values.data(), missMask.data()),
+              43U);
+    for (std::size_t i = 0; i < names.size(); ++i) {
+        EXPECT_EQ(values[i], EnumTraits<Fruits>::fromStr(names[i])) << i;
+        EXPECT_EQ(((missMask[i / 64] >> (i % 64)) & 1) != 0, values[i] == EnumTraits<Fruits>::Invalid) << i;
+    }
+
+    std::vector<std::uint32_t> offsets(values.size());
+    std::vector<std::uint32_t> lengths(values.size());
+    EnumTraits<Fruits>::namesBatch(values.data(), values.size(), offsets.data(), lengths.data());
+    for (std::size_t i = 0; i < values.size(); ++i) {
+        const StringView name(EnumTraits<Fruits>::namePool() + offsets[i], lengths[i]);
+        EXPECT_EQ(name, EnumTraits<Fruits>::name(values[i])) << i;
+    }
+
+    // same length and first, middle and last characters, so the names are bucketed by the string hash
+    enum class Tiles { Abxa, Acxa, Bbxb };
+    static_assert(detail::hasDistinctSamples<detail::EnumKeys<Fruits>>(), "");
+    static_assert(!detail::hasDistinctSamples<detail::EnumKeys<Tiles>>(), "");
+    const StringView tileNames[] = { StringView("Acxa", 4), StringView("Adxa", 4), StringView("Abxa", 4) };
+    Tiles tiles[3];
+    std::uint64_t tileMiss = 0;
+    EXPECT_EQ(EnumTraits<Tiles>::fromStrBatch(tileNames, 3, tiles, &tileMiss), 1U);
+    EXPECT_EQ(tiles[0], Tiles::Acxa);
+    EXPECT_EQ(tiles[1], EnumTraits<Tiles>::Invalid);
+    EXPECT_EQ(tiles[2], Tiles::Abxa);
+    EXPECT_EQ(tileMiss, 2U);
+}
+
+TEST(enumTraits, index) {
+    enum class Fruits { Apples = -2, Oranges = 5, Pears = 8, Bananas = 11 };
+    static_assert(EnumTraits<Fruits>::count() == 4, "");
+    static_assert(EnumTraits<Fruits>::index(Fruits::Apples) == 0, "");
+    static_assert(EnumTraits<Fruits>::index(Fruits::Bananas) == 3, "");
+    static_assert(EnumTraits<Fruits>::fromIndex(2) == Fruits::Pears, "");
+    EXPECT_EQ(EnumTraits<Fruits>::index(static_cast<Fruits>(6)), 4U);
+    EXPECT_EQ(EnumTraits<Fruits>::index(static_cast<Fruits>(-100)), 4U);
+    EXPECT_EQ(EnumTraits<Fruits>::fromIndex(4), EnumTraits<Fruits>::Invalid);
+    for (std::size_t i = 0; i < EnumTraits<Fruits>::count(); ++i) {
+        EXPECT_EQ(EnumTraits<Fruits>::index(EnumTraits<Fruits>::fromIndex(i)), i);
+    }
+}
+
+TEST(enumTraits, isValid) {
+    enum class Fruits { Apples = -2, Oranges = 5, Pears = 8, Bananas = 11 };
+    static_assert(EnumTraits<Fruits>::isValid(Fruits::Pears), "");
+    static_assert(!EnumTraits<Fruits>::isValid(static_cast<Fruits>(6)), "");
+    EXPECT_TRUE(EnumTraits<Fruits>::isValid(-2));
+    EXPECT_TRUE(EnumTraits<Fruits>::isValid(11));
+    EXPECT_FALSE(EnumTraits<Fruits>::isValid(12));
+    EXPECT_FALSE(EnumTraits<Fruits>::isValid(-3));
+    EXPECT_FALSE(EnumTraits<Fruits>::isValid(-1000000));
+
+    std::vector<int> column(200, 8);
+    EXPECT_EQ(EnumTraits<Fruits>::validate(column.data(), column.size()), column.size());
+    column[150] = 3;
+    column[170] = 4;
+    EXPECT_EQ(EnumTraits<Fruits>::validate(column.data(), column.size()), 150U);
+    column[20] = 100;
+    EXPECT_EQ(EnumTraits<Fruits>::validate(column.data(), column.size()), 20U);
+    column[20] = 5;
+    column[150] = 5;
+    EXPECT_EQ(EnumTraits<Fruits>::validate(column.data(), column.size()), 170U);
+    EXPECT_EQ(EnumTraits<Fruits>::validate(column.data(), 0), 0U);
+}
+
+TEST(enumExtern, lookups) {
+    using Traits = EnumTraits<Planets>;
+    static_assert(std::is_base_of<ExternEnumTraits<Planets>, Traits>::value, "");
+    EXPECT_EQ(Traits::min(), -3);
+    EXPECT_EQ(Traits::max(), 9);
+    EXPECT_EQ(Traits::count(), 4U);
+    EXPECT_THAT(Traits::values(),
+                ElementsAre(Planets::Mercury, Planets::Venus, Planets::Earth, Planets::Mars));
+    EXPECT_THAT(Traits::names(), ElementsAre("Mercury", "Venus", "Earth", "Mars"));
+
+    EXPECT_EQ(Traits::name(Planets::Earth), "Earth");
+    EXPECT_EQ(Traits::name(static_cast<Planets>(5)), "");
+    EXPECT_EQ(Traits::name(static_cast<Planets>(100)), "");
+    EXPECT_TRUE(Traits::isValid(Planets::Mars));
+    EXPECT_FALSE(Traits::isValid(-2));
+    EXPECT_EQ(Traits::index(Planets::Earth), 2U);
+    EXPECT_EQ(Traits::fromIndex(3), Planets::Mars);
+    EXPECT_EQ(Traits::fromIndex(4), Traits::Invalid);
+
+    EXPECT_EQ(Traits::fromStr("Venus"), Planets::Venus);
+    EXPECT_EQ(Traits::fromStr(StringView("Marsh", 4)), Planets::Mars);
+    EXPECT_EQ(Traits::fromStr("Pluto"), Traits::Invalid);
+
+    char buffer[8];
+    EXPECT_EQ(Traits::writeName(Planets::Mercury, buffer, sizeof(buffer)), 7U);
+    EXPECT_EQ(std::string(buffer, 7), "Mercury");
+    std::ostringstream os;
+    os << nameOf(Planets::Mars);
+    EXPECT_EQ(os.str(), "Mars");
+}
+
+TEST(enumCodec, encode) {
+    enum class Fruits { Apples = -2, Oranges = 5, Pears = 8, Bananas = 11, Kiwis = 100 };
+    using Codec = EnumCodec<Fruits>;
+    static_assert(std::is_same<Codec::CodeType, uint8_t>::value, "");
+    static_assert(Codec::bits == 3, "");
+    static_assert(Codec::encode(Fruits::Pears) == 2, "");
+    static_assert(Codec::decode(4) == Fruits::Kiwis, "");
+    EXPECT_EQ(Codec::decode(5), EnumTraits<Fruits>::Invalid);
+
+    enum class Reordered { Oranges = 5, Apples = -2, Pears = 8, Bananas = 11, Kiwis = 100 };
+    enum class Renamed { Apples = -2, Oranges = 5, Pears = 8, Bananas = 11, Kiwi = 100 };
+    enum class Renumbered { Apples = -2, Oranges = 5, Pears = 8, Bananas = 11, Kiwis = 101 };
+    static_assert(Codec::fingerprint == EnumCodec<Reordered>::fingerprint, "");
+    static_assert(Codec::fingerprint != EnumCodec<Renamed>::fingerprint, "");
+    static_assert(Codec::fingerprint != EnumCodec<Renumbered>::fingerprint, "");
+
+    std::vector<Fruits> values;
+    for (std::size_t i = 0; i < 37; ++i) {
+        values.push_back(EnumTraits<Fruits>::fromIndex(i * 7 % 5));
+    }
+    std::vector<std::uint8_t> packed(Codec::packedSize(values.size()));
+    EXPECT_EQ(packed.size(), 14U);
+    Codec::pack(values.data(), values.size(), packed.data());
+    std::vector<Fruits> unpacked(values.size());
+    EXPECT_EQ(Codec::unpack(packed.data(), unpacked.size(), unpacked.data()), 0U);
+    EXPECT_EQ(unpacked, values);
+
+    packed[0] |= 7;
+    EXPECT_EQ(Codec::unpack(packed.data(), unpacked.size(), unpacked.data()), 1U);
+    EXPECT_EQ(unpacked[0], EnumTraits<Fruits>::Invalid);
+    EXPECT_EQ(unpacked[1], values[1]);
+}
+
+TEST(enumStats, counters) {
+    enum class Juices { Apple = 2, Orange = 5 };
+    using Traits = EnumTraits<Juices>;
+#if !ENUM_TRAITS_INSTRUMENTATION || ENUM_TRAITS_HAS_CONSTANT_EVALUATED
+    static_assert(Traits::fromStr("Apple") == Juices::Apple, "");
+    static_assert(Traits::name(Juices::Orange) == "Orange", "");
+#endif
+
+    // every lookup runs in a new thread, whose sampling countdown starts with a timed lookup
+    std::vector<std::thread> threads;
+    for (std::size_t t = 0; t < 4; ++t) {
+        threads.emplace_back([] {
+            for (std::size_t i = 0; i < 100; ++i) {
+                EXPECT_EQ(Traits::fromStr("Apple"), Juices::Apple);
+            }
+        });
+    }
+    threads.emplace_back([] {
+        EXPECT_EQ(Traits::fromStr("Kiwi"), Traits::Invalid);
+        EXPECT_EQ(Traits::fromStr("orange", ParsePolicy<IgnoreCase>()), Juices::Orange);
+    });
+    for (std::thread& thread : threads) {
+        thread.join();
+    }
+    EXPECT_EQ(Traits::name(Juices::Orange), "Orange");
+    EXPECT_EQ(Traits::name(static_cast<Juices>(3)), "");
+
+    const EnumStatsSnapshot stats = enumStats<Juices>();
+    const std::string type(stats.type.data(), stats.type.size());
+    EXPECT_THAT(type, EndsWith("Juices"));
+#if ENUM_TRAITS_INSTRUMENTATION
+    EXPECT_EQ(stats.hits, 402U);
+    EXPECT_EQ(stats.misses, 1U);
+    EXPECT_EQ(stats.invalid, 1U);
+    std::uint64_t sampled = 0;
+    for (const std::uint64_t count : stats.latency) {
+        sampled += count;
+    }
+    const auto timed = [](const std::uint64_t lookups) -> std::uint64_t {
+        const std::uint64_t every = ENUM_TRAITS_LATENCY_SAMPLING;
+        return every > 0 ? (lookups + every - 1) / every : 0;
+    };
+    EXPECT_EQ(sampled, 4 * timed(100) + timed(2));
+
+    std::size_t visited = 0;
+    forEachEnumStats([&](const EnumStatsSnapshot& other) {
+        visited += other.type == stats.type ? 1 : 0;
+    });
+    EXPECT_EQ(visited, 1U);
+    std::ostringstream dump;
+    dumpEnumStats(dump);
+    EXPECT_THAT(dump.str(), HasSubstr("Juices: hits=402 misses=1 invalid=1\n"));
+#else
+    EXPECT_EQ(stats.hits + stats.misses + stats.invalid, 0U);
+#endif
+}
+
+TEST(enumConvert, byName) {
+    enum class Wire : uint8_t { Apples = 1, Pears = 2, Plums = 3, Kiwis = 10 };
+    enum class Domain { Kiwis = -5, Apples = 20, Pears = 40 };
+    EXPECT_EQ(convert<Domain>(Wire::Apples), Domain::Apples);
+    EXPECT_EQ(convert<Domain>(Wire::Kiwis), Domain::Kiwis);
+    EXPECT_EQ(convert<Domain>(Wire::Plums), EnumTraits<Domain>::Invalid);
+    EXPECT_EQ(convert<Domain>(static_cast<Wire>(5)), EnumTraits<Domain>::Invalid);
+    EXPECT_EQ(convert<Domain>(static_cast<Wire>(200)), EnumTraits<Domain>::Invalid);
+    static_assert(convert<Domain>(Wire::Pears) == Domain::Pears, "");
+    EXPECT_THAT((unmatchedValues<Domain, Wire>()), ElementsAre(Wire::Plums));
+
+    EXPECT_EQ(convertStrict<Wire>(Domain::Pears), Wire::Pears);
+    static_assert(unmatchedValues<Wire, Domain>().size() == 0, "");
+}
+
+TEST(enumContainers, array) {
+    enum class Fruits { Apples = -2, Oranges = 5, Pears = 8, Bananas = 11 };
+    EnumArray<Fruits, int> counters;
+    static_assert(EnumArray<Fruits, int>::size() == 4, "");
+    EXPECT_THAT(counters, ElementsAre(0, 0, 0, 0));
+    counters[Fruits::Pears] += 2;
+    counters[Fruits::Apples] = 7;
+    EXPECT_THAT(counters, ElementsAre(7, 0, 2, 0));
+    EXPECT_EQ(counters[Fruits::Pears], 2);
+
+    const EnumArray<Fruits, int> filled(3);
+    EXPECT_THAT(filled, ElementsAre(3, 3, 3, 3));
+    const auto keys = EnumArray<Fruits, int>::keys();
+    EXPECT_THAT(keys, ElementsAre(Fruits::Apples, Fruits::Oranges, Fruits::Pears, Fruits::Bananas));
+}
+
+TEST(enumContainers, set) {
+    enum class Fruits { Apples = -2, Oranges = 5, Pears = 8, Bananas = 11 };
+    EnumSet<Fruits> set{ Fruits::Pears, Fruits::Apples };
+    EXPECT_EQ(set.size(), 2U);
+    EXPECT_TRUE(set.contains(Fruits::Pears));
+    EXPECT_FALSE(set.contains(Fruits::Oranges));
+    EXPECT_FALSE(set.contains(static_cast<Fruits>(6)));
+    EXPECT_THAT(set, ElementsAre(Fruits::Apples, Fruits::Pears));
+
+    set.insert(static_cast<Fruits>(6)); // ignored
+    set.insert(Fruits::Bananas);
+    set.erase(Fruits::Apples);
+    EXPECT_THAT(set, ElementsAre(Fruits::Pears, Fruits::Bananas));
+
+    const EnumSet<Fruits> all = EnumSet<Fruits>::all();
+    EXPECT_EQ(all.size(), 4U);
+    EXPECT_THAT(all - set, ElementsAre(Fruits::Apples, Fruits::Oranges));
+    EXPECT_EQ(all & set, set);
+    EXPECT_EQ(all ^ set, all - set);
+    EXPECT_EQ((all - set) | set, all);
+    set.clear();
+    EXPECT_TRUE(set.empty());
+    EXPECT_THAT(set, ElementsAre());
+
+    enum class Letters { A, B, C, D, E, F, G, H, I, J, K, L, M, N, O, P, Q, R, S, T, U, V, W, X, Y, Z,
+                         AA, BB, CC, DD, EE, FF, GG, HH, II, JJ, KK, LL, MM, NN, OO, PP, QQ, RR, SS, TT,
+                         AAA, BBB, CCC, DDD, EEE, FFF, GGG, HHH, III, JJJ, KKK, LLL, MMM, NNN, OOO, PPP,
+                         QQQ, RRR, SSS, TTT };
+    EXPECT_EQ(EnumSet<Letters>::all().size(), 66U);
+    EnumSet<Letters> letters{ Letters::B, Letters::TTT, Letters::PPP };
+    EXPECT_THAT(letters, ElementsAre(Letters::B, Letters::PPP, Letters::TTT));
+}
+
+TEST(enumContainers, map) {
+    enum class Fruits { Apples = -2, Oranges = 5, Pears = 8, Bananas = 11 };
+    EnumMap<Fruits, std::string> map;
+    EXPECT_TRUE(map.empty());
+    map[Fruits::Bananas] = "yellow";
+    map[Fruits::Apples] = "red";
+    EXPECT_EQ(map.size(), 2U);
+    EXPECT_THAT(map.keys(), ElementsAre(Fruits::Apples, Fruits::Bananas));
+    ASSERT_NE(map.find(Fruits::Apples), nullptr);
+    EXPECT_EQ(*map.find(Fruits::Apples), "red");
+    EXPECT_EQ(map.find(Fruits::Pears), nullptr);
+    EXPECT_TRUE(map.erase(Fruits::Apples));
+    EXPECT_FALSE(map.erase(Fruits::Apples));
+    EXPECT_FALSE(map.contains(Fruits::Apples));
+    EXPECT_THAT(map.keys(), ElementsAre(Fruits::Bananas));
+
+    EXPECT_TRUE(map.insert(Fruits::Pears, "green"));
+    EXPECT_FALSE(map.insert(static_cast<Fruits>(6), "blue"));
+    EXPECT_THAT(map.keys(), ElementsAre(Fruits::Pears, Fruits::Bananas));
+    EXPECT_EQ(*map.find(Fruits::Pears), "green");
+}
+
+TEST(enumFlags, names) {
+    enum class Permissions : uint32_t { None = 0, Read = 1, Write = 2, Execute = 4, Admin = 1 << 20 };
+    EXPECT_EQ(EnumFlags<Permissions>::mask(), 0x100007U);
+    EXPECT_THAT(EnumFlags<Permissions>::names(), ElementsAre("Read", "Write", "Execute", "Admin", "None"));
+    EXPECT_THAT(EnumFlags<Permissions>::values(),
+                ElementsAre(Permissions::Read,
+                            Permissions::Write,
+                            Permissions::Execute,
+                            Permissions::Admin,
+                            Permissions::None));
+
+    enum class Wide : uint64_t { Low = 1, High = 1ULL << 63 };
+    EXPECT_THAT(EnumFlags<Wide>::names(), ElementsAre("Low", "High"));
+}
+
+TEST(enumFlags, format) {
+    enum class Permissions : uint32_t { None = 0, Read = 1, Write = 2, Execute = 4, Admin = 1 << 20 };
+    const auto format = [](const uint32_t value) {
+        char buffer[64];
+        const std::size_t size =
+            EnumFlags<Permissions>::format(static_cast<Permissions>(value), buffer, sizeof(buffer));
+        return std::string(buffer, size);
+    };
+    EXPECT_EQ(format(0), "None");
+    EXPECT_EQ(format(1), "Read");
+    EXPECT_EQ(format(3), "Read|Write");
+    EXPECT_EQ(format((1 << 20) | 4), "Execute|Admin");
+    EXPECT_EQ(format(0x31), "Read|0x30");
+
+    enum class Unnamed : uint8_t { A = 1 };
+    char buffer[8];
+    EXPECT_EQ(EnumFlags<Unnamed>::format(static_cast<Unnamed>(0), buffer, sizeof(buffer)), 3U);
+    EXPECT_EQ(std::string(buffer, 3), "0x0");
+
+    // truncated output reports the full length
+    EXPECT_EQ(EnumFlags<Permissions>::format(static_cast<Permissions>(3), buffer, 4), 10U);
+    EXPECT_EQ(std::string(buffer, 4), "Read");
+}
+
+TEST(enumFlags, parse) {
+    enum class Permissions : uint32_t { None = 0, Read = 1, Write = 2, Execute = 4, Admin = 1 << 20 };
+    Permissions value = Permissions::None;
+    EXPECT_TRUE(EnumFlags<Permissions>::parse("Read|Write", value));
+    EXPECT_EQ(value, static_cast<Permissions>(3));
+    EXPECT_TRUE(EnumFlags<Permissions>::parse("Admin | Execute", value));
+    EXPECT_EQ(value, static_cast<Permissions>((1 << 20) | 4));
+    EXPECT_TRUE(EnumFlags<Permissions>::parse("None", value));
+    EXPECT_EQ(value, Permissions::None);
+    EXPECT_TRUE(EnumFlags<Permissions>::parse("Read|0x30", value));
+    EXPECT_EQ(value, static_cast<Permissions>(0x31));
+
+    value = Permissions::Read;
+    EXPECT_FALSE(EnumFlags<Permissions>::parse("Read|Delete", value));
+    EXPECT_FALSE(EnumFlags<Permissions>::parse("", value));
+    EXPECT_FALSE(EnumFlags<Permissions>::parse("Read|", value));
+    EXPECT_FALSE(EnumFlags<Permissions>::parse("0x123456789", value));
+    EXPECT_EQ(value, Permissions::Read);
 }
 
 int main(int argc, char** argv) {